@@ -0,0 +1,126 @@
+//
+// Created on 10/19/26.
+//
+
+// times the recording analysis over thousands of synthetic recordings, on the machine running make
+// usage: bench [recording count]
+// this is only good for comparing changes against each other, the console is a lot slower
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "analysis.h"
+#include "spectrum.h"
+#include "inputevents.h"
+#include "stickmap.h"
+#include "recording.h"
+
+#define BENCH_DEFAULT_RECORDINGS 5000
+// fftFixed() calls for the kernel on its own
+#define BENCH_FFT_CALLS 20000
+
+enum BENCH_STAGE { STAGE_PIVOT, STAGE_DASHBACK, STAGE_SNAPBACK, STAGE_POWERSHIELD, STAGE_RESAMPLE,
+		STAGE_EVENTS, STAGE_MELEE, STAGE_SPECTRUM, STAGE_LEN };
+static const char *STAGE_NAMES[STAGE_LEN] = { "analyzePivot", "analyzeDashback", "analyzeSnapback",
+		"analyzePowershield", "resampleRecording", "feedInputEventDetector", "convertStickRawToMelee",
+		"analyzeSpectrum" };
+
+static ControllerRec rec;
+static int readIndices[REC_SAMPLE_MAX];
+static InputEventDetector detector;
+static SpectrumResult spectrum;
+static int16_t fftReal[SPECTRUM_SIZE];
+static int16_t fftImag[SPECTRUM_SIZE];
+
+int main(int argc, char **argv) {
+	int recordingCount = BENCH_DEFAULT_RECORDINGS;
+	if (argc > 1) {
+		recordingCount = atoi(argv[1]);
+	}
+	seedHostRandom(1);
+	initStickmaps();
+	const Stickmap *shieldDropMap = findStickmap("Shield Drop");
+	
+	uint64_t stageUs[STAGE_LEN] = { 0 };
+	uint64_t sampleCount = 0;
+	// keeps the results from being optimized out
+	volatile float sink = 0;
+	
+	for (int n = 0; n < recordingCount; n++) {
+		makeSyntheticRecording(&rec, n % SYNTH_KIND_LEN);
+		sampleCount += rec.sampleEnd;
+		
+		PivotResult pivot;
+		DashbackResult dashback;
+		SnapbackResult snapback;
+		PowershieldResult powershield;
+		
+		uint64_t startUs = getHostTimeUs();
+		analyzePivot(&rec, AXIS_AX, &pivot);
+		uint64_t endUs = getHostTimeUs();
+		stageUs[STAGE_PIVOT] += endUs - startUs;
+		
+		startUs = endUs;
+		analyzeDashback(&rec, AXIS_AX, &dashback);
+		endUs = getHostTimeUs();
+		stageUs[STAGE_DASHBACK] += endUs - startUs;
+		
+		startUs = endUs;
+		analyzeSnapback(&rec, AXIS_AX, SNAPBACK_SETTLE_UNITS, &snapback);
+		endUs = getHostTimeUs();
+		stageUs[STAGE_SNAPBACK] += endUs - startUs;
+		
+		startUs = endUs;
+		analyzePowershield(&rec, &powershield);
+		endUs = getHostTimeUs();
+		stageUs[STAGE_POWERSHIELD] += endUs - startUs;
+		
+		startUs = endUs;
+		int readCount = resampleRecording(&rec, n % FRAME_TIME_US, readIndices, REC_SAMPLE_MAX);
+		endUs = getHostTimeUs();
+		stageUs[STAGE_RESAMPLE] += endUs - startUs;
+		
+		startUs = endUs;
+		initInputEventDetector(&detector, shieldDropMap);
+		for (int i = 0; i < readCount; i++) {
+			feedInputEventDetector(&detector, &rec.samples[readIndices[i]], readIndices[i]);
+		}
+		endUs = getHostTimeUs();
+		stageUs[STAGE_EVENTS] += endUs - startUs;
+		
+		startUs = endUs;
+		int unitSum = 0;
+		for (int i = 0; i < rec.sampleEnd; i++) {
+			unitSum += convertStickRawToMelee(rec.samples[i]).stickXUnit;
+		}
+		endUs = getHostTimeUs();
+		stageUs[STAGE_MELEE] += endUs - startUs;
+		
+		startUs = endUs;
+		analyzeSpectrum(&rec, AXIS_AX, 0, &spectrum);
+		endUs = getHostTimeUs();
+		stageUs[STAGE_SPECTRUM] += endUs - startUs;
+		
+		sink += pivot.pivotPercent + dashback.ucfPercent + snapback.deadzoneFramesAvg + powershield.adtPercent +
+		        detector.eventCount + unitSum + spectrum.peakBin;
+	}
+	
+	// the fft on its own, starting from q14 noise
+	// every call scales the values down, but the work doesn't depend on them
+	for (int i = 0; i < SPECTRUM_SIZE; i++) {
+		fftReal[i] = (int) getHostRandom(1 << 15) - (1 << 14);
+	}
+	uint64_t fftStartUs = getHostTimeUs();
+	for (int i = 0; i < BENCH_FFT_CALLS; i++) {
+		fftFixed(fftReal, fftImag);
+	}
+	uint64_t fftUs = getHostTimeUs() - fftStartUs;
+	sink += fftReal[1];
+	
+	printf("%d recordings, %llu samples\n", recordingCount, (unsigned long long) sampleCount);
+	for (int i = 0; i < STAGE_LEN; i++) {
+		printf("%-24s %10.3f us/recording\n", STAGE_NAMES[i], (double) stageUs[i] / recordingCount);
+	}
+	printf("%-24s %10.3f us/call, %d points\n", "fftFixed", (double) fftUs / BENCH_FFT_CALLS, SPECTRUM_SIZE);
+	return (sink == -1) ? 1 : 0;
+}
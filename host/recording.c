@@ -0,0 +1,246 @@
+//
+// Created on 10/19/26.
+//
+
+#include "recording.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+#include <time.h>
+
+static uint32_t randomState = 1;
+
+void seedHostRandom(uint32_t seed) {
+	// xorshift gets stuck at 0
+	randomState = (seed == 0) ? 1 : seed;
+}
+
+uint32_t getHostRandom(uint32_t range) {
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return (range == 0) ? 0 : randomState % range;
+}
+
+enum SYNTHETIC_TIMING { TIMING_FIXED, TIMING_JITTER, TIMING_MIXED, TIMING_LEN };
+
+// time until the next poll
+static uint64_t getSyntheticPollUs(enum SYNTHETIC_TIMING timing, uint64_t fixedUs) {
+	switch (timing) {
+		case TIMING_FIXED:
+			return fixedUs;
+		case TIMING_JITTER:
+			return fixedUs - (fixedUs / 4) + getHostRandom(fixedUs / 2);
+		case TIMING_MIXED:
+		default:
+			return (getHostRandom(8) == 0) ? FRAME_TIME_US : 100 + getHostRandom(3000);
+	}
+}
+
+static int8_t clampStick(int value) {
+	if (value > 127) {
+		return 127;
+	}
+	if (value < -127) {
+		return -127;
+	}
+	return value;
+}
+
+void makeSyntheticRecording(ControllerRec *rec, enum SYNTHETIC_KIND kind) {
+	memset(rec->samples, 0, sizeof(rec->samples));
+	rec->recordingType = REC_OSCILLOSCOPE;
+	
+	enum SYNTHETIC_TIMING timing = getHostRandom(TIMING_LEN);
+	uint64_t fixedUs = 250 + getHostRandom(2000);
+	uint64_t durationUs = 100000 + getHostRandom(400000);
+	int side = getHostRandom(2) ? 1 : -1;
+	
+	// when the interesting part starts, and how long it lasts
+	// it's usually a few frames, but sometimes a lot longer, like a slow input
+	uint64_t startUs = 10000 + getHostRandom(40000);
+	uint64_t holdUs = (getHostRandom(4) == 0) ? getHostRandom(400000) : getHostRandom(50000);
+	int slowValue = 23 + getHostRandom(41);
+	int dashValue = 64 + getHostRandom(64);
+	// snapback ringing, in hz and ms, a worn out stick can ring for a lot longer
+	float ringHz = 10 + getHostRandom(40);
+	float decayMs = 5 + ((getHostRandom(4) == 0) ? getHostRandom(400) : getHostRandom(60));
+	int wander = 0;
+	uint8_t analog = 0;
+	
+	if (kind == SYNTH_TRIGGER) {
+		rec->recordingType = getHostRandom(2) ? REC_TRIGGER_R : REC_TRIGGER_L;
+	}
+	
+	uint64_t timeUs = 0;
+	int i = 0;
+	while (i < REC_SAMPLE_MAX && timeUs < durationUs) {
+		ControllerSample *sample = &rec->samples[i];
+		sample->timeDiffUs = (i == 0) ? 0 : getSyntheticPollUs(timing, fixedUs);
+		timeUs += sample->timeDiffUs;
+		
+		int x = 0;
+		switch (kind) {
+			case SYNTH_DASHBACK:
+				// origin, then the slow-turn range, then the dash range
+				if (timeUs >= startUs + holdUs) {
+					x = dashValue;
+				} else if (timeUs >= startUs) {
+					x = slowValue;
+				}
+				x *= side;
+				break;
+			case SYNTH_PIVOT:
+				// one side, then the other for a short time, then back to the origin
+				if (timeUs >= startUs + holdUs + 30000) {
+					x = 0;
+				} else if (timeUs >= startUs + 30000) {
+					x = 90 * side;
+				} else if (timeUs >= startUs) {
+					x = -90 * side;
+				}
+				break;
+			case SYNTH_SNAPBACK:
+				// held out, then let go and ringing around the origin
+				if (timeUs < startUs) {
+					x = 100 * side;
+				} else {
+					float t = (timeUs - startUs) / 1000.0f;
+					x = lroundf(100 * side * expf(-t / decayMs) * cosf(2 * (float) M_PI * ringHz * t / 1000.0f));
+				}
+				break;
+			case SYNTH_TRIGGER:
+				// analog ramps up, the digital press lands somewhere after it
+				if (timeUs >= startUs && analog < 255 - 16) {
+					analog += getHostRandom(16);
+				}
+				if (timeUs >= startUs + holdUs) {
+					sample->buttons = (rec->recordingType == REC_TRIGGER_R) ? 0x0020 : 0x0040;
+				}
+				sample->triggerL = analog;
+				sample->triggerR = analog;
+				break;
+			case SYNTH_WANDER:
+			default:
+				wander += (int) getHostRandom(17) - 8;
+				wander = clampStick(wander);
+				x = wander;
+				break;
+		}
+		sample->stickX = clampStick(x + (int) getHostRandom(3) - 1);
+		sample->stickY = clampStick((int) getHostRandom(5) - 2);
+		sample->cStickX = clampStick(-x);
+		i++;
+	}
+	
+	rec->sampleEnd = i;
+	rec->totalTimeUs = timeUs;
+	rec->isRecordingReady = true;
+}
+
+// longest row exportData() writes is REC_BUTTONTIME's, well under this
+#define EXPORT_LINE_MAX 128
+
+// parses one row of an exported recording, the columns depend on the recording type
+static bool parseExportedSample(const char *line, enum RECORDING_TYPE type, ControllerSample *sample) {
+	int x = 0, y = 0, cx = 0, cy = 0;
+	unsigned int analog = 0, analogR = 0, buttons = 0;
+	uint64_t timeDiffUs = 0;
+	
+	switch (type) {
+		case REC_OSCILLOSCOPE:
+			// X, Y, CX, CY, time from last poll
+			if (sscanf(line, "%d,%d,%d,%d,%" SCNu64, &x, &y, &cx, &cy, &timeDiffUs) != 5) {
+				return false;
+			}
+			break;
+		case REC_2DPLOT:
+			// X, Y, buttons, time from last poll
+			if (sscanf(line, "%d,%d,%u,%" SCNu64, &x, &y, &buttons, &timeDiffUs) != 4) {
+				return false;
+			}
+			break;
+		case REC_TRIGGER_L:
+		case REC_TRIGGER_R:
+			// analog, digital (already masked to the trigger's bit), time from last poll
+			if (sscanf(line, "%u,%u,%" SCNu64, &analog, &buttons, &timeDiffUs) != 3) {
+				return false;
+			}
+			analogR = analog;
+			break;
+		case REC_BUTTONTIME:
+			// X, Y, CX, CY, analog L, analog R, buttons, time from last poll
+			if (sscanf(line, "%d,%d,%d,%d,%u,%u,%u,%" SCNu64, &x, &y, &cx, &cy, &analog, &analogR, &buttons,
+			           &timeDiffUs) != 8) {
+				return false;
+			}
+			break;
+		default:
+			return false;
+	}
+	
+	sample->stickX = clampStick(x);
+	sample->stickY = clampStick(y);
+	sample->cStickX = clampStick(cx);
+	sample->cStickY = clampStick(cy);
+	sample->triggerL = analog;
+	sample->triggerR = analogR;
+	sample->buttons = buttons;
+	sample->timeDiffUs = timeDiffUs;
+	return true;
+}
+
+bool loadExportedRecording(ControllerRec *rec, const char *path) {
+	memset(rec->samples, 0, sizeof(rec->samples));
+	rec->isRecordingReady = false;
+	
+	FILE *fptr = fopen(path, "r");
+	if (fptr == NULL) {
+		return false;
+	}
+	
+	// first row is: datetime, number of polls, total time in microseconds, type of recording
+	char line[EXPORT_LINE_MAX];
+	unsigned int sampleEnd = 0;
+	uint64_t totalTimeUs = 0;
+	int type = REC_CLEAR;
+	if (fgets(line, EXPORT_LINE_MAX, fptr) == NULL ||
+	    sscanf(line, "%*[^,],%u,%" SCNu64 ",%d", &sampleEnd, &totalTimeUs, &type) != 3 ||
+	    sampleEnd == 0 || sampleEnd > REC_SAMPLE_MAX) {
+		fclose(fptr);
+		return false;
+	}
+	
+	rec->recordingType = type;
+	unsigned int i = 0;
+	while (i < sampleEnd && fgets(line, EXPORT_LINE_MAX, fptr) != NULL) {
+		if (!parseExportedSample(line, type, &rec->samples[i])) {
+			break;
+		}
+		i++;
+	}
+	fclose(fptr);
+	
+	// a cut off file is as good as a wrong one, the sample count is written first
+	if (i != sampleEnd) {
+		return false;
+	}
+	
+	rec->sampleEnd = sampleEnd;
+	rec->totalTimeUs = totalTimeUs;
+	rec->isRecordingReady = true;
+	return true;
+}
+
+bool isRecordingPath(const char *arg) {
+	size_t length = strlen(arg);
+	return length > 4 && strcmp(arg + length - 4, ".csv") == 0;
+}
+
+uint64_t getHostTimeUs() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
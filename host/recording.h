@@ -0,0 +1,37 @@
+//
+// Created on 10/19/26.
+//
+
+// recordings for the host tests and benchmarks, see the host target in the Makefile
+// synthetic ones come from a seeded generator, so every run gets the same recordings
+// real ones are the csv files gts exports to /GTS/ on the sd card, see exportData() in file.c
+
+#ifndef GTS_HOST_RECORDING_H
+#define GTS_HOST_RECORDING_H
+
+#include <stdint.h>
+
+#include "waveform.h"
+
+enum SYNTHETIC_KIND { SYNTH_DASHBACK, SYNTH_PIVOT, SYNTH_SNAPBACK, SYNTH_WANDER, SYNTH_TRIGGER, SYNTH_KIND_LEN };
+
+void seedHostRandom(uint32_t seed);
+// uniform in [0, range)
+uint32_t getHostRandom(uint32_t range);
+
+// fills rec with a recording of the given kind, and a random length and poll timing
+// the timing is fixed, jittered, or a mix of fast polls and whole frames, like the different polling modes
+void makeSyntheticRecording(ControllerRec *rec, enum SYNTHETIC_KIND kind);
+
+// reads a recording exported by gts into rec
+// false if the file can't be read or isn't an exported recording, like the _frames.csv and _snapback.csv files
+// written next to it
+bool loadExportedRecording(ControllerRec *rec, const char *path);
+
+// true if arg looks like a path to an exported recording instead of a number, for the programs' arguments
+bool isRecordingPath(const char *arg);
+
+// microseconds on a monotonic clock
+uint64_t getHostTimeUs();
+
+#endif //GTS_HOST_RECORDING_H
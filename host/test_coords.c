@@ -0,0 +1,109 @@
+//
+// Created on 10/19/26.
+//
+
+// checks every possible pair of stick values in convertStickRawToMelee() against the float math it replaced
+// `make hosttest` runs this with the default table, and as test_coords_full with MELEE_COORD_LUT_FULL
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "waveform.h"
+#include "recording.h"
+
+// how many times each pair is converted for the timing
+#define TEST_TIMING_PASSES 20
+
+// convertStickRawToMelee() from before the table, unchanged
+static MeleeCoordinates convertStickRawToMeleeFloat(ControllerSample sample) {
+	
+	float floatStickX = abs(sample.stickX), floatStickY = abs(sample.stickY);
+	float floatCStickX = abs(sample.cStickX), floatCStickY = abs(sample.cStickY);
+	
+	float stickMagnitude = sqrt((sample.stickX * sample.stickX) + (sample.stickY * sample.stickY));
+	float cStickMagnitude = sqrt((sample.cStickX * sample.cStickX) + (sample.cStickY * sample.cStickY));
+	
+	// magnitude must be between 0 and 80
+	if (stickMagnitude > 80) {
+		// scale stick value to be within range
+		floatStickX = (floatStickX / stickMagnitude) * 80;
+		floatStickY = (floatStickY / stickMagnitude) * 80;
+	}
+	if (cStickMagnitude > 80) {
+		// scale stick value to be within range
+		floatCStickX = (floatCStickX / cStickMagnitude) * 80;
+		floatCStickY = (floatCStickY / cStickMagnitude) * 80;
+	}
+	
+	MeleeCoordinates ret;
+	
+	// truncate the floats
+	ret.stickXUnit = (int) floatStickX, ret.stickYUnit = (int) floatStickY;
+	ret.cStickXUnit = (int) floatCStickX, ret.cStickYUnit = (int) floatCStickY;
+	
+	// convert to the decimal format for melee
+	ret.stickXUnit = (((float) ret.stickXUnit) * 0.0125) * 10000;
+	ret.stickYUnit = (((float) ret.stickYUnit) * 0.0125) * 10000;
+	ret.cStickXUnit = (((float) ret.cStickXUnit) * 0.0125) * 10000;
+	ret.cStickYUnit = (((float) ret.cStickYUnit) * 0.0125) * 10000;
+	
+	// record if a given axis was negative, since we don't retain that info in the converted units
+	ret.stickXNegative = (sample.stickX < 0) ? true : false;
+	ret.stickYNegative = (sample.stickY < 0) ? true : false;
+	ret.cStickXNegative = (sample.cStickX < 0) ? true : false;
+	ret.cStickYNegative = (sample.cStickY < 0) ? true : false;
+	
+	return ret;
+}
+
+static bool coordinatesMatch(MeleeCoordinates a, MeleeCoordinates b) {
+	return a.stickXUnit == b.stickXUnit && a.stickYUnit == b.stickYUnit &&
+	       a.cStickXUnit == b.cStickXUnit && a.cStickYUnit == b.cStickYUnit &&
+	       a.stickXNegative == b.stickXNegative && a.stickYNegative == b.stickYNegative &&
+	       a.cStickXNegative == b.cStickXNegative && a.cStickYNegative == b.cStickYNegative;
+}
+
+int main() {
+	int failed = 0;
+	// both sticks go through every pair, the c-stick in a different order so the two aren't always the same
+	for (int x = -128; x <= 127; x++) {
+		for (int y = -128; y <= 127; y++) {
+			ControllerSample sample = { .stickX = x, .stickY = y, .cStickX = y, .cStickY = -1 - x };
+			MeleeCoordinates expected = convertStickRawToMeleeFloat(sample);
+			MeleeCoordinates actual = convertStickRawToMelee(sample);
+			if (!coordinatesMatch(expected, actual)) {
+				failed++;
+				if (failed <= 10) {
+					printf("(%d, %d): expected %u %u / %u %u, got %u %u / %u %u\n", x, y,
+					       expected.stickXUnit, expected.stickYUnit, expected.cStickXUnit, expected.cStickYUnit,
+					       actual.stickXUnit, actual.stickYUnit, actual.cStickXUnit, actual.cStickYUnit);
+				}
+			}
+		}
+	}
+	
+	#ifdef MELEE_COORD_LUT_FULL
+	const char *tableName = "full table";
+	#else
+	const char *tableName = "quadrant table";
+	#endif
+	printf("melee coordinates, %s: %d/65536 pairs match\n", tableName, 65536 - failed);
+	
+	// keeps the results from being optimized out
+	volatile uint32_t sink = 0;
+	uint64_t elapsedUs[2];
+	for (int pass = 0; pass < 2; pass++) {
+		uint64_t startUs = getHostTimeUs();
+		for (int i = 0; i < 65536 * TEST_TIMING_PASSES; i++) {
+			ControllerSample sample = { .stickX = i, .stickY = i >> 8, .cStickX = i >> 3, .cStickY = i >> 5 };
+			MeleeCoordinates coords = (pass == 0) ? convertStickRawToMeleeFloat(sample) : convertStickRawToMelee(sample);
+			sink += coords.stickXUnit + coords.cStickYUnit;
+		}
+		elapsedUs[pass] = getHostTimeUs() - startUs;
+	}
+	printf("float %.2f ns/call, table %.2f ns/call\n", elapsedUs[0] * 1000.0 / (65536 * TEST_TIMING_PASSES),
+	       elapsedUs[1] * 1000.0 / (65536 * TEST_TIMING_PASSES));
+	
+	return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,399 @@
+//
+// Created on 10/19/26.
+//
+
+// checks analyzeDashback() against the straightforward version of the same math, over synthetic recordings and
+// any exported recordings given on the command line
+// the straightforward version looks up every game read at every microsecond of the poll phase, which is
+// O(phases * reads * log(samples)), analyzeDashback() only handles the points where a read crosses into the next
+// sample, see sweepFramePhase()
+// that only checks the sweep, classifyReference() has the same rules as analysis.c. the rules themselves changed
+// in this series, so the results are also compared against a frozen copy of the oscilloscope's loop from before
+// it, and the differences are printed. those don't fail the test, they're what changed on purpose.
+// usage: test_dashback [recording count] [exported recording.csv ...]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "analysis.h"
+#include "recording.h"
+
+#define TEST_DEFAULT_RECORDINGS 2000
+
+static ControllerRec rec;
+// start time of each sample, same as getSampleTimeUs() in analysis.c
+static int64_t sampleTimeUs[REC_SAMPLE_MAX];
+// the axis getValueAt() reads
+static enum CONTROLLER_STICK_AXIS checkAxis = AXIS_AX;
+// same as the snapback export
+static const char *AXIS_NAMES[] = { "x", "y", "cx", "cy" };
+
+// the sample that's current at timeUs, the stick is at the origin before the first one
+static int8_t getValueAt(int64_t timeUs) {
+	int low = 0, high = rec.sampleEnd - 1;
+	int index = -1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (sampleTimeUs[mid] <= timeUs) {
+			index = mid;
+			low = mid + 1;
+		} else {
+			high = mid - 1;
+		}
+	}
+	return (index < 0) ? 0 : getControllerSampleAxisValue(rec.samples[index], checkAxis);
+}
+
+enum REFERENCE_OUTCOME { REF_SUCCESS, REF_UCF_SUCCESS, REF_FAIL, REF_OUTCOME_LEN };
+
+// vanilla fails on any read in the slow-turn range before the dash range
+// ucf only fails when the stick moved 75 units or less across the reads on either side of one of those
+static int classifyReference(const int8_t *values, int count) {
+	int outcome = REF_SUCCESS;
+	for (int i = 0; i < count && abs(values[i]) < 64; i++) {
+		if (abs(values[i]) < 23) {
+			continue;
+		}
+		if (i == 0 || i + 1 == count ||
+		    abs(values[i - 1] - values[i]) + abs(values[i] - values[i + 1]) <= 75) {
+			return REF_FAIL;
+		}
+		outcome = REF_UCF_SUCCESS;
+	}
+	return outcome;
+}
+
+// false if the result doesn't match
+static bool checkDashback(const DashbackResult *result) {
+	if (result->startIndex == -1) {
+		// never stayed in the slow-turn range, all or nothing
+		return result->timeInRangeUs == 0 && result->vanillaPercent == result->ucfPercent &&
+		       (result->vanillaPercent == 0 || result->vanillaPercent == 100);
+	}
+	
+	int64_t windowStartUs = sampleTimeUs[result->startIndex];
+	int64_t windowEndUs = sampleTimeUs[result->endIndex + 1];
+	if ((uint64_t) (windowEndUs - windowStartUs) != result->timeInRangeUs) {
+		return false;
+	}
+	
+	// one read before the slow-turn range and one after it
+	int readCount = ((windowEndUs - windowStartUs) / FRAME_TIME_US) + 3;
+	int8_t *values = malloc(readCount);
+	uint32_t outcomeUs[REF_OUTCOME_LEN] = { 0 };
+	for (int phase = 0; phase < FRAME_TIME_US; phase++) {
+		for (int i = 0; i < readCount; i++) {
+			values[i] = getValueAt(windowStartUs - FRAME_TIME_US + ((int64_t) i * FRAME_TIME_US) + phase);
+		}
+		outcomeUs[classifyReference(values, readCount)]++;
+	}
+	free(values);
+	
+	float vanillaPercent = (outcomeUs[REF_SUCCESS] * 100.0) / FRAME_TIME_US;
+	float ucfPercent = ((outcomeUs[REF_SUCCESS] + outcomeUs[REF_UCF_SUCCESS]) * 100.0) / FRAME_TIME_US;
+	return result->vanillaPercent == vanillaPercent && result->ucfPercent == ucfPercent;
+}
+
+// the oscilloscope's DASHBACK case as it was before this series, only changed to return instead of print
+// samples past sampleEnd read as zero here, the original read whatever was left in the buffer
+// everything else is kept as it was, including the int8_t overflows, since this is what the old numbers were
+static ControllerSample getPreSeriesSample(const ControllerRec *data, int index) {
+	if (index >= data->sampleEnd || index >= REC_SAMPLE_MAX) {
+		return (ControllerSample) { 0 };
+	}
+	return data->samples[index];
+}
+
+static void analyzePreSeriesDashback(const ControllerRec *dispData, enum CONTROLLER_STICK_AXIS workingAxis,
+                                     float *vanillaOut, float *ucfOut) {
+	// go forward in list
+	int dashbackStartIndex = -1, dashbackEndIndex = -1;
+	uint64_t timeInRange = 0;
+	bool stickInDashRange = false;
+	
+	// iterate over the list, find the start and end point where the X axis is in the
+	// slow-turn range [23,63]
+	// we also check if the X axis reaches the dash range (64+)
+	for (int i = 0; i < dispData->sampleEnd; i++) {
+		int8_t curr = abs(getControllerSampleAxisValue(dispData->samples[i], workingAxis));
+		// is the stick in the dash range?
+		// note that this is independent from the other if
+		if (curr >= 65) {
+			// mark that we did cross that threshold
+			stickInDashRange = true;
+			// did we miss the slow-turn range?
+			if (dashbackStartIndex == -1) {
+				break;
+			}
+		}
+		
+		// is the stick in the slow-turn range
+		if ((curr >= 23 && curr < 64)) {
+			timeInRange += dispData->samples[i].timeDiffUs;
+			// set this as the first sample that is in slow-turn range
+			if (dashbackStartIndex == -1) {
+				dashbackStartIndex = i;
+			}
+		} else if (dashbackStartIndex != -1) {
+			dashbackEndIndex = i - 1;
+			// stick has left the slow-turn range, there's no need to continue
+			// checking the list
+			break;
+		}
+	}
+	
+	float dashbackPercent = 0.0;
+	float ucfPercent = 0.0;
+	
+	if (dashbackEndIndex == -1) {
+		// stick did not get polled in slow-turn range, but did get to dash range,
+		// so this should pass???
+		if (stickInDashRange) {
+			dashbackPercent = 100;
+			ucfPercent = 100;
+		}
+		// stick did not hit dash range, fail
+		else {
+			dashbackPercent = 0.0;
+			ucfPercent = 0.0;
+		}
+	} else {
+		// convert time in microseconds to float time in milliseconds
+		float timeInRangeMs = (timeInRange / 1000.0);
+		
+		// vanilla dashback is just the amount of time the stick was in the slow-turn range
+		// over the total time for one frame
+		// (subtracted from 1.0 because we want to show the _success_ rate)
+		dashbackPercent = (1.0 - (timeInRangeMs / FRAME_TIME_MS_F)) * 100;
+		
+		// ucf dashback is a little more involved
+		
+		// we iterate over each sample in the slow-turn range, calculate what the next
+		// frame would be based on that sample, and check if it meets the requirements
+		// for the dash-intention check (total units moved across those two frame >75)
+		uint64_t ucfTimeInRange = timeInRange;
+		for (int i = dashbackStartIndex; i <= dashbackEndIndex; i++) {
+			// for ucf testing, we need to find the samples that occur on both the
+			// previous frame and the frame after
+			uint64_t usFromPoll = 0;
+			int nextPollIndex = i, prevPollIndex = i;
+			
+			// first find poll that would occur around 1f before
+			// if this fails to find a poll due to running out of data, we'll assume
+			// the poll happened around the origin
+			while (usFromPoll < FRAME_TIME_US && prevPollIndex >= 0) {
+				usFromPoll += dispData->samples[prevPollIndex].timeDiffUs;
+				prevPollIndex--;
+			}
+			
+			// reset this since we reuse it...
+			usFromPoll = 0;
+			
+			// now find the poll that would occur around 1f after
+			while (usFromPoll < FRAME_TIME_US && nextPollIndex != dispData->sampleEnd) {
+				nextPollIndex++;
+				usFromPoll += getPreSeriesSample(dispData, nextPollIndex).timeDiffUs;
+			}
+			
+			// exit if we've hit the end of the list somehow
+			// idk how this would happen except _maybe_ on box
+			if (usFromPoll < FRAME_TIME_US) {
+				break;
+			}
+			
+			// ucf dash intention check
+			// the two frames need to move more than 75 units for UCF to convert it.
+			// there are two cases we handle here:
+			// - one where we found a poll ~1f before
+			// - one where we do _not_ find a poll ~1f before
+			// in the first case, we calculate how many total units the stick moved from
+			// that previous poll, and in the second case we assume the poll was
+			// around the origin, so we can just use the second poll's value as the total
+			int8_t dashIntentionCount = 0;
+			
+			// first case: we need to actually find the total units moved
+			if (prevPollIndex >= 0) {
+				dashIntentionCount = abs(
+						getControllerSampleAxisValue(dispData->samples[prevPollIndex], workingAxis) -
+						getControllerSampleAxisValue(dispData->samples[i], workingAxis) );
+				
+				dashIntentionCount += abs(
+						getControllerSampleAxisValue(dispData->samples[i], workingAxis) -
+						getControllerSampleAxisValue(getPreSeriesSample(dispData, nextPollIndex), workingAxis) );
+			}
+			// second case: we assume previous poll is at origin (0,0), and just use
+			// the value in nextPollIndex
+			else {
+				dashIntentionCount = abs(getControllerSampleAxisValue(getPreSeriesSample(dispData, nextPollIndex),
+				                                                      workingAxis));
+			}
+			
+			// did the stick move enough units to trigger the dash intention check?
+			if (dashIntentionCount > 75) {
+				// since we're iterating over each sample in the slow-turn range,
+				// if the dash intention check passes, we subtract its time from
+				// the total time that a slow-turn _could_ occur.
+				// in theory, after this loops finishes, ucfTimeInRange will only contain
+				// the time when the dash intention check could fail.
+				ucfTimeInRange -= dispData->samples[i].timeDiffUs;
+			}
+		}
+		
+		float ucfTimeInRangeMs = ucfTimeInRange / 1000.0;
+		
+		// this means all of the samples in the dash range passed the intention check,
+		// so we give it 100%
+		if (ucfTimeInRangeMs <= 0) {
+			ucfPercent = 100;
+		} else {
+			// one or more samples didn't pass the intention check, do normal calculation
+			ucfPercent = (1.0 - (ucfTimeInRangeMs / FRAME_TIME_MS_F)) * 100;
+		}
+		
+		// this shouldn't happen in theory, maybe on box?
+		if (dashbackPercent > 100) {
+			dashbackPercent = 100;
+		}
+		if (ucfPercent > 100) {
+			ucfPercent = 100;
+		}
+		// this definitely can happen though
+		if (dashbackPercent < 0) {
+			dashbackPercent = 0;
+		}
+		if (ucfPercent < 0) {
+			ucfPercent = 0;
+		}
+	}
+	
+	*vanillaOut = dashbackPercent;
+	*ucfOut = ucfPercent;
+}
+
+// how far analyzeDashback() is from the pre-series loop, percents within this are counted as the same
+#define PRE_SERIES_TOLERANCE 0.01
+
+typedef struct PreSeriesDiff {
+	int compared;
+	int vanillaChanged;
+	int ucfChanged;
+	float vanillaMax;
+	float ucfMax;
+} PreSeriesDiff;
+
+// returns true if either percent changed from the pre-series loop
+static bool comparePreSeries(const DashbackResult *result, float vanillaPercent, float ucfPercent,
+                             PreSeriesDiff *diff) {
+	float vanillaDiff = fabsf(result->vanillaPercent - vanillaPercent);
+	float ucfDiff = fabsf(result->ucfPercent - ucfPercent);
+	diff->compared++;
+	if (vanillaDiff > PRE_SERIES_TOLERANCE) {
+		diff->vanillaChanged++;
+	}
+	if (ucfDiff > PRE_SERIES_TOLERANCE) {
+		diff->ucfChanged++;
+	}
+	diff->vanillaMax = fmaxf(diff->vanillaMax, vanillaDiff);
+	diff->ucfMax = fmaxf(diff->ucfMax, ucfDiff);
+	return vanillaDiff > PRE_SERIES_TOLERANCE || ucfDiff > PRE_SERIES_TOLERANCE;
+}
+
+static void printPreSeriesDiff(const char *name, const PreSeriesDiff *diff) {
+	printf("%s against the pre-series loop: vanilla changed on %d/%d (up to %.1f%%), ucf on %d/%d (up to %.1f%%)\n",
+	       name, diff->vanillaChanged, diff->compared, diff->vanillaMax, diff->ucfChanged, diff->compared,
+	       diff->ucfMax);
+}
+
+static void setSampleTimes() {
+	int64_t timeUs = 0;
+	for (int i = 0; i < rec.sampleEnd; i++) {
+		timeUs += rec.samples[i].timeDiffUs;
+		sampleTimeUs[i] = timeUs;
+	}
+}
+
+int main(int argc, char **argv) {
+	int recordingCount = TEST_DEFAULT_RECORDINGS;
+	int firstPath = 1;
+	if (argc > 1 && !isRecordingPath(argv[1])) {
+		recordingCount = atoi(argv[1]);
+		firstPath = 2;
+	}
+	seedHostRandom(2);
+	
+	int checked = 0, failed = 0;
+	uint64_t sweepUs = 0, referenceUs = 0;
+	PreSeriesDiff syntheticDiff = { 0 };
+	for (int n = 0; n < recordingCount; n++) {
+		// mostly dashbacks, with some other recordings to make sure nothing else gets picked up
+		makeSyntheticRecording(&rec, (n % 4 == 0) ? SYNTH_WANDER : SYNTH_DASHBACK);
+		setSampleTimes();
+		
+		DashbackResult result;
+		uint64_t startUs = getHostTimeUs();
+		analyzeDashback(&rec, AXIS_AX, &result);
+		uint64_t endUs = getHostTimeUs();
+		bool matches = checkDashback(&result);
+		sweepUs += endUs - startUs;
+		referenceUs += getHostTimeUs() - endUs;
+		
+		float vanillaPercent, ucfPercent;
+		analyzePreSeriesDashback(&rec, AXIS_AX, &vanillaPercent, &ucfPercent);
+		comparePreSeries(&result, vanillaPercent, ucfPercent, &syntheticDiff);
+		
+		checked++;
+		if (!matches) {
+			failed++;
+			if (failed <= 10) {
+				printf("recording %d: samples %d-%d, %llu us in range, vanilla %.3f ucf %.3f\n", n,
+				       result.startIndex, result.endIndex, (unsigned long long) result.timeInRangeUs,
+				       result.vanillaPercent, result.ucfPercent);
+			}
+		}
+	}
+	
+	// real recordings, every stick axis since any of them could have the dashback
+	PreSeriesDiff exportedDiff = { 0 };
+	for (int arg = firstPath; arg < argc; arg++) {
+		if (!loadExportedRecording(&rec, argv[arg])) {
+			printf("%s: not an exported recording\n", argv[arg]);
+			failed++;
+			continue;
+		}
+		if (rec.recordingType == REC_TRIGGER_L || rec.recordingType == REC_TRIGGER_R) {
+			continue;
+		}
+		setSampleTimes();
+		
+		for (checkAxis = AXIS_AX; checkAxis <= AXIS_CY; checkAxis++) {
+			DashbackResult result;
+			analyzeDashback(&rec, checkAxis, &result);
+			bool matches = checkDashback(&result);
+			float vanillaPercent, ucfPercent;
+			analyzePreSeriesDashback(&rec, checkAxis, &vanillaPercent, &ucfPercent);
+			bool changed = comparePreSeries(&result, vanillaPercent, ucfPercent, &exportedDiff);
+			
+			checked++;
+			if (!matches) {
+				failed++;
+			}
+			if (!matches || changed) {
+				printf("%s %s: %s, vanilla %.1f%% ucf %.1f%%, pre-series vanilla %.1f%% ucf %.1f%%\n",
+				       argv[arg], AXIS_NAMES[checkAxis], matches ? "matches" : "DOESN'T MATCH",
+				       result.vanillaPercent, result.ucfPercent, vanillaPercent, ucfPercent);
+			}
+		}
+	}
+	
+	printf("dashback: %d/%d recordings match\n", checked - failed, checked);
+	if (recordingCount > 0) {
+		printf("analyzeDashback %.3f us/recording, reference %.3f us/recording\n",
+		       (double) sweepUs / recordingCount, (double) referenceUs / recordingCount);
+		printPreSeriesDiff("synthetic", &syntheticDiff);
+	}
+	if (exportedDiff.compared > 0) {
+		printPreSeriesDiff("exported", &exportedDiff);
+	}
+	return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+//
+// Created on 10/19/26.
+//
+
+// feeds short input sequences through the input event detector, and checks which events come out
+
+#include <stdio.h>
+#include <string.h>
+
+#include "inputevents.h"
+#include "analysis.h"
+
+// one game frame of input
+typedef struct TestFrame {
+	int8_t x;
+	int8_t y;
+	uint16_t buttons;
+} TestFrame;
+
+#define TEST_JUMP 0x0400
+#define TEST_EVENTS_MAX 8
+
+static InputEventDetector detector;
+static int failed = 0;
+
+// events is -1 terminated
+static void checkSequence(const char *name, const TestFrame *frames, int frameCount, const int *events) {
+	initInputEventDetector(&detector, findStickmap("Shield Drop"));
+	for (int i = 0; i < frameCount; i++) {
+		ControllerSample sample = { .stickX = frames[i].x, .stickY = frames[i].y, .buttons = frames[i].buttons };
+		feedInputEventDetector(&detector, &sample, i);
+	}
+	
+	bool matches = true;
+	int count = getInputEventBufferedCount(&detector);
+	for (int i = 0; i <= count; i++) {
+		const InputEvent *event = getInputEvent(&detector, i);
+		int actual = (event == NULL) ? -1 : event->type;
+		if (actual != events[i]) {
+			matches = false;
+			break;
+		}
+	}
+	
+	printf("%-32s %s\n", name, matches ? "ok" : "FAILED");
+	if (!matches) {
+		failed++;
+		for (int i = 0; i < count; i++) {
+			printf("    frame %u: %s\n", getInputEvent(&detector, i)->frame,
+			       getInputEventName(getInputEvent(&detector, i)->type));
+		}
+	}
+}
+
+#define CHECK(name, frames, ...) \
+	checkSequence(name, frames, sizeof(frames) / sizeof(TestFrame), (const int[]) { __VA_ARGS__, -1 })
+
+int main() {
+	initStickmaps();
+	
+	// the stick y that's in the vanilla shield drop region
+	int8_t shieldDropY = 0;
+	for (int y = 0; y > -128; y--) {
+		ControllerSample sample = { .stickY = y };
+		if (getStickmapRegionIndex(findStickmap("Shield Drop"), convertStickRawToMelee(sample)) != 0) {
+			shieldDropY = y;
+			break;
+		}
+	}
+	
+	const TestFrame dash[] = { { 0, 0, 0 }, { 80, 0, 0 }, { 80, 0, 0 } };
+	CHECK("dash", dash, EVENT_DASH);
+	
+	const TestFrame walk[] = { { 0, 0, 0 }, { 40, 0, 0 }, { 50, 0, 0 }, { 80, 0, 0 } };
+	CHECK("walk", walk, -1);
+	
+	const TestFrame dashback[] = { { 80, 0, 0 }, { 80, 0, 0 }, { 0, 0, 0 }, { -80, 0, 0 }, { -80, 0, 0 } };
+	CHECK("dashback", dashback, EVENT_DASH, EVENT_DASHBACK);
+	
+	const TestFrame pivot[] = { { 80, 0, 0 }, { 80, 0, 0 }, { -80, 0, 0 }, { 0, 0, 0 } };
+	CHECK("pivot", pivot, EVENT_DASH, EVENT_PIVOT);
+	
+	const TestFrame shieldDrop[] = { { 0, 0, ANALYSIS_TRIGGER_L }, { 0, 0, ANALYSIS_TRIGGER_L },
+			{ 0, shieldDropY, ANALYSIS_TRIGGER_L } };
+	CHECK("shield drop", shieldDrop, EVENT_SHIELD_DROP);
+	
+	const TestFrame wavedash[] = { { 0, 0, TEST_JUMP }, { 0, 0, 0 }, { 0, 0, 0 }, { 60, -40, 0 },
+			{ 60, -40, ANALYSIS_TRIGGER_R } };
+	CHECK("wavedash", wavedash, EVENT_WAVEDASH);
+	
+	const TestFrame tapJumpWavedash[] = { { 0, 90, 0 }, { 0, 90, 0 }, { 0, 0, 0 }, { -60, -40, ANALYSIS_TRIGGER_L } };
+	CHECK("wavedash from a tap jump", tapJumpWavedash, EVENT_WAVEDASH);
+	
+	// shielding or rolling with the stick down, no jump
+	const TestFrame shieldDown[] = { { 0, 0, 0 }, { 60, -40, 0 }, { 60, -40, ANALYSIS_TRIGGER_R } };
+	CHECK("shield with the stick down", shieldDown, -1);
+	
+	const TestFrame sameFrame[] = { { 0, 0, 0 }, { 60, -40, TEST_JUMP | ANALYSIS_TRIGGER_R } };
+	CHECK("jump and airdodge together", sameFrame, -1);
+	
+	TestFrame lateAirdodge[INPUT_EVENT_JUMP_FRAMES + 2] = { { 0, 0, TEST_JUMP } };
+	lateAirdodge[INPUT_EVENT_JUMP_FRAMES + 1] = (TestFrame) { 60, -40, ANALYSIS_TRIGGER_R };
+	CHECK("airdodge long after a jump", lateAirdodge, -1);
+	
+	const TestFrame airdodgeUp[] = { { 0, 0, TEST_JUMP }, { 0, 0, 0 }, { 60, 40, ANALYSIS_TRIGGER_R } };
+	CHECK("airdodge up", airdodgeUp, -1);
+	
+	return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+//
+// Created on 10/19/26.
+//
+
+// checks the deadzone frames from analyzeSnapback() against looking up every game read at every microsecond
+// of the poll phase, same idea as test_dashback.c
+// synthetic recordings only ring on the x axis, exported ones given on the command line are checked on every axis
+// usage: test_snapback [recording count] [exported recording.csv ...]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "analysis.h"
+#include "recording.h"
+
+#define TEST_DEFAULT_RECORDINGS 1000
+
+static ControllerRec rec;
+// start time of each sample, same as getSampleTimeUs() in analysis.c
+static int64_t sampleTimeUs[REC_SAMPLE_MAX];
+// the axis getValueAt() reads
+static enum CONTROLLER_STICK_AXIS checkAxis = AXIS_AX;
+// same as the snapback export
+static const char *AXIS_NAMES[] = { "x", "y", "cx", "cy" };
+
+// the sample that's current at timeUs, the stick is at the origin before the first one
+static int8_t getValueAt(int64_t timeUs) {
+	int low = 0, high = rec.sampleEnd - 1;
+	int index = -1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (sampleTimeUs[mid] <= timeUs) {
+			index = mid;
+			low = mid + 1;
+		} else {
+			high = mid - 1;
+		}
+	}
+	return (index < 0) ? 0 : getControllerSampleAxisValue(rec.samples[index], checkAxis);
+}
+
+// false if the result doesn't match
+static bool checkSnapback(const SnapbackResult *result) {
+	if (!result->valid) {
+		return result->deadzoneFramesMax == 0 && result->deadzoneFramesAvg == 0;
+	}
+	
+	// every read from the release to the end of the recording
+	int64_t releaseUs = sampleTimeUs[result->releaseIndex];
+	int readCount = ((sampleTimeUs[rec.sampleEnd - 1] - releaseUs) / FRAME_TIME_US) + 1;
+	int sign = (result->releaseValue < 0) ? -1 : 1;
+	
+	int framesMax = 0;
+	double frameSum = 0;
+	for (int phase = 0; phase < FRAME_TIME_US; phase++) {
+		int frames = 0;
+		for (int i = 0; i < readCount; i++) {
+			if (getValueAt(releaseUs + ((int64_t) i * FRAME_TIME_US) + phase) * sign < -SNAPBACK_DEADZONE) {
+				frames++;
+			}
+		}
+		if (frames > framesMax) {
+			framesMax = frames;
+		}
+		frameSum += frames;
+	}
+	
+	// the average is summed in a different order, so it can be off in the last bits
+	return result->deadzoneFramesMax == framesMax &&
+	       fabs(result->deadzoneFramesAvg - (frameSum / FRAME_TIME_US)) < 0.001;
+}
+
+static void setSampleTimes() {
+	int64_t timeUs = 0;
+	for (int i = 0; i < rec.sampleEnd; i++) {
+		timeUs += rec.samples[i].timeDiffUs;
+		sampleTimeUs[i] = timeUs;
+	}
+}
+
+int main(int argc, char **argv) {
+	int recordingCount = TEST_DEFAULT_RECORDINGS;
+	int firstPath = 1;
+	if (argc > 1 && !isRecordingPath(argv[1])) {
+		recordingCount = atoi(argv[1]);
+		firstPath = 2;
+	}
+	seedHostRandom(3);
+	
+	int checked = 0, failed = 0;
+	for (int n = 0; n < recordingCount; n++) {
+		makeSyntheticRecording(&rec, SYNTH_SNAPBACK);
+		setSampleTimes();
+		
+		SnapbackResult result;
+		analyzeSnapback(&rec, AXIS_AX, SNAPBACK_SETTLE_UNITS, &result);
+		checked++;
+		if (!checkSnapback(&result)) {
+			failed++;
+			if (failed <= 10) {
+				printf("recording %d: release at %d, deadzone frames max %d avg %.3f\n", n, result.releaseIndex,
+				       result.deadzoneFramesMax, result.deadzoneFramesAvg);
+			}
+		}
+	}
+	
+	for (int arg = firstPath; arg < argc; arg++) {
+		if (!loadExportedRecording(&rec, argv[arg])) {
+			printf("%s: not an exported recording\n", argv[arg]);
+			failed++;
+			continue;
+		}
+		if (rec.recordingType == REC_TRIGGER_L || rec.recordingType == REC_TRIGGER_R) {
+			continue;
+		}
+		setSampleTimes();
+		
+		for (checkAxis = AXIS_AX; checkAxis <= AXIS_CY; checkAxis++) {
+			SnapbackResult result;
+			analyzeSnapback(&rec, checkAxis, SNAPBACK_SETTLE_UNITS, &result);
+			bool matches = checkSnapback(&result);
+			checked++;
+			if (!matches) {
+				failed++;
+			}
+			if (result.valid) {
+				printf("%s %s: %s, release %d, deadzone frames max %d avg %.3f\n", argv[arg],
+				       AXIS_NAMES[checkAxis], matches ? "matches" : "DOESN'T MATCH", result.releaseValue,
+				       result.deadzoneFramesMax, result.deadzoneFramesAvg);
+			}
+		}
+	}
+	
+	printf("snapback: %d/%d recordings match\n", checked - failed, checked);
+	return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+//
+// Created on 10/19/26.
+//
+
+// melee-specific analysis of recordings, the math behind the oscilloscope and trigger test results
+// this only depends on waveform.h, no ogc headers, so it can be built and run on its own, see `make host`
+
+#ifndef GTS_ANALYSIS_H
+#define GTS_ANALYSIS_H
+
+#include <stdint.h>
+
+#include "waveform.h"
+
+// digital trigger bits in ControllerSample.buttons
+// same as PAD_TRIGGER_L and PAD_TRIGGER_R from ogc/pad.h, redefined here since `make host` builds this without ogc
+#define ANALYSIS_TRIGGER_L 0x0040
+#define ANALYSIS_TRIGGER_R 0x0020
+
+// the percents for pivot and dashback are exact for the recording, every possible phase of the game's poll
+// is checked against the recorded samples, see sweepFramePhase() in analysis.c
+
+typedef struct PivotResult {
+	// false if the recording doesn't contain a pivot input, the percents are set to a dashback in that case
+	bool valid;
+	// time the stick spent in the dash range, for the second half of the pivot
+	uint64_t timeInRangeUs;
+	float noTurnPercent;
+	float pivotPercent;
+	float dashbackPercent;
+} PivotResult;
+
+typedef struct DashbackResult {
+	// first and last samples in the slow-turn range, -1 if the stick never stayed in it
+	int startIndex;
+	int endIndex;
+	uint64_t timeInRangeUs;
+	float vanillaPercent;
+	float ucfPercent;
+} DashbackResult;
+
+typedef struct PowershieldResult {
+	// false if the recording isn't a trigger recording
+	bool valid;
+	// the digital press happened somewhere in the recording
+	bool digitalPressed;
+	// time the analog value was in the shield range before the digital press
+	uint64_t timeInAnalogRangeUs;
+	float digitalPercent;
+	float adtPercent;
+	float nonePercent;
+} PowershieldResult;
+
+// units from center the stick has to stay within to count as settled, for analyzeSnapback()
+#define SNAPBACK_SETTLE_UNITS 5
+// melee ignores anything within this many units of center
+#define SNAPBACK_DEADZONE 22
+
+typedef struct SnapbackResult {
+	// false if the stick never left the settle range
+	bool valid;
+	// furthest point from center, where the stick was let go
+	int8_t releaseValue;
+	int releaseIndex;
+	// furthest point past center on the other side, after the release, 0 if it never crossed
+	int8_t overshoot;
+	// false if the recording ended before the stick settled, settleTimeUs is to the end of the recording then
+	bool settled;
+	// from the release until the stick stays within the settle range
+	uint64_t settleTimeUs;
+	int zeroCrossings;
+	// 0 if there aren't enough crossings or lobes to tell
+	float ringingHz;
+	// time for the ringing to decay to 1/e of its size
+	float decayMs;
+	// game frames that read past the deadzone on the other side, worst phase and averaged over every phase
+	int deadzoneFramesMax;
+	float deadzoneFramesAvg;
+} SnapbackResult;
+
+// the game reads the controller once a frame, this turns raw polls into the samples the game would read
+// reads happen at phaseUs + (n * FRAME_TIME_US) from the start of the recording, and get whichever sample
+// is current at that time
+typedef struct FrameResampler {
+	// start time of the latest sample fed in
+	int64_t timeUs;
+	// time of the next game read
+	int64_t nextReadUs;
+	// number of samples fed in so far
+	int sampleCount;
+} FrameResampler;
+
+// phaseUs should be less than FRAME_TIME_US
+void initFrameResampler(FrameResampler *resampler, uint32_t phaseUs);
+// feed in the next sample's timeDiffUs, returns how many game reads landed on the sample before it
+// a sample is current until the next one starts, so its reads are only known once the next sample is fed in
+int feedFrameResampler(FrameResampler *resampler, uint64_t timeDiffUs);
+// fills readIndices with the sample index of each game read in the recording, returns the number of reads
+// the recording ends at the start of its last sample, so reads after that aren't included
+int resampleRecording(const ControllerRec *rec, uint32_t phaseUs, int *readIndices, int maxReads);
+
+// pivot likelihood from the last pivot input in the recording, on a single stick axis
+void analyzePivot(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, PivotResult *result);
+
+// vanilla and ucf dashback success rates from the first slow-turn in the recording, on a single stick axis
+void analyzeDashback(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, DashbackResult *result);
+
+// snapback after the stick is let go, on a single stick axis
+void analyzeSnapback(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int settleUnits,
+                     SnapbackResult *result);
+
+// projectile powershield likelihood, for REC_TRIGGER_L and REC_TRIGGER_R recordings
+void analyzePowershield(const ControllerRec *rec, PowershieldResult *result);
+
+#endif //GTS_ANALYSIS_H
@@ -0,0 +1,99 @@
+//
+// Created on 10/19/26.
+//
+
+// melee inputs picked out of a stream of samples as they come in, for the continuous oscilloscope
+// the detector only ever looks at the frame the game just read and a few values carried over from earlier frames,
+// so feeding it is the same amount of work no matter how long it runs
+// like analysis.h, this doesn't depend on ogc, and the feed doesn't use floats, so it's fine in a sampling callback
+
+#ifndef GTS_INPUTEVENTS_H
+#define GTS_INPUTEVENTS_H
+
+#include <stdint.h>
+
+#include "waveform.h"
+#include "stickmap.h"
+
+// same thresholds as analysis.c, on the raw analog stick
+#define INPUT_EVENT_DEADZONE 22
+#define INPUT_EVENT_DASH 64
+// standing still, the stick has to get to the dash range within this many reads past the deadzone, or it's a walk
+#define INPUT_EVENT_DASH_SLOW_FRAMES 1
+// a dash the other way within this many frames of the last one counts as a dashback
+// this is roughly the longest initial dash, the detector doesn't know which character is being played
+#define INPUT_EVENT_TURN_FRAMES 15
+// start of melee's analog shield range
+#define INPUT_EVENT_SHIELD_ANALOG 43
+// an airdodge only counts as a wavedash if there was a jump within this many frames before it
+// jumpsquat is 3 to 8 frames depending on the character, with a couple frames of leeway after that
+#define INPUT_EVENT_JUMP_FRAMES 10
+// x and y, same as PAD_BUTTON_X and PAD_BUTTON_Y from ogc/pad.h
+#define INPUT_EVENT_JUMP_BUTTONS 0x0C00
+// the analog stick going up past this is a tap jump
+#define INPUT_EVENT_TAP_JUMP 53
+
+// oldest events are dropped once there's more than this
+#define INPUT_EVENT_MAX 64
+
+enum INPUT_EVENT_TYPE { EVENT_DASH, EVENT_DASHBACK, EVENT_PIVOT, EVENT_SHIELD_DROP, EVENT_WAVEDASH, EVENT_TYPE_LEN };
+
+typedef struct InputEvent {
+	// number of the sample the game read, as counted by whoever feeds the detector
+	uint32_t sampleNumber;
+	// game frames since the detector was reset
+	uint32_t frame;
+	uint8_t type;
+	// -1 for left, 1 for right, 0 if the stick is in the deadzone on x
+	int8_t direction;
+	// dash, dashback and pivot: reads in the slow-turn range right before the dash range
+	// for a dashback or pivot, vanilla slow-turns if this isn't 0, see analyzeDashback()
+	// shield drop: region of the shield drop stickmap
+	uint8_t detail;
+	// analog stick in melee units, same scale as MeleeCoordinates, negative is left or down
+	int16_t meleeX;
+	int16_t meleeY;
+} InputEvent;
+
+typedef struct InputEventDetector {
+	// what the game read last frame
+	int8_t prevDashSide;
+	bool prevShielding;
+	bool prevAirdodge;
+	bool prevJump;
+	int prevShieldDropRegion;
+	
+	// side of the last dash, and frames since it started
+	int8_t dashSide;
+	uint32_t framesSinceDash;
+	// consecutive reads in the slow-turn range, and which side they're on
+	int8_t slowTurnSide;
+	uint8_t slowTurnFrames;
+	// pivotEvent is a dashback from last frame, that turns into a pivot if this frame leaves the dash range
+	bool pivotPending;
+	uint32_t pivotEvent;
+	// stops counting at INPUT_EVENT_JUMP_FRAMES + 1, nothing older than that matters
+	uint8_t framesSinceJump;
+	
+	uint32_t frame;
+	// regions for shield drops, no shield drops are detected if this is NULL
+	const Stickmap *shieldDropMap;
+	
+	// ring buffer, the newest event is at (eventCount - 1) % INPUT_EVENT_MAX
+	InputEvent events[INPUT_EVENT_MAX];
+	// every event detected since the reset, not just the ones still in the buffer
+	uint32_t eventCount;
+} InputEventDetector;
+
+void initInputEventDetector(InputEventDetector *detector, const Stickmap *shieldDropMap);
+// feed in each sample the game reads, in order, returns the number of events it added
+int feedInputEventDetector(InputEventDetector *detector, const ControllerSample *sample, uint32_t sampleNumber);
+// events still in the buffer, index 0 is the oldest, NULL if index is past the end
+const InputEvent *getInputEvent(const InputEventDetector *detector, int index);
+int getInputEventBufferedCount(const InputEventDetector *detector);
+
+const char *getInputEventName(enum INPUT_EVENT_TYPE type);
+// wavedash angle below horizontal, in degrees
+float getInputEventAngle(const InputEvent *event);
+
+#endif //GTS_INPUTEVENTS_H
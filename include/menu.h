@@ -26,6 +26,16 @@ void menu_fileExport();
 void menu_thanksPage();
 
 void menu_setCurrentMenu(enum CURRENT_MENU menu);
+enum CURRENT_MENU menu_getCurrentMenu();
+
+// called by a menu when the frame it just drew will look the same next frame,
+// as long as no buttons are held, the sticks are near neutral, and recordings don't change
+// (no animations, timers, analog trigger values, etc.)
+// only applies to the current frame, needs to be called every frame
+void menu_setFrameStatic();
+// false if the last frame was static and nothing has changed since, the previous framebuffer can be shown again
+// this reads the controller if needed, so it should be called right before menu_runMenu()
+bool menu_needsRedraw();
 
 void menu_drawHeader();
 
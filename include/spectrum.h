@@ -0,0 +1,48 @@
+//
+// Created on 10/19/26.
+//
+
+// frequency content of a recording, for spotting spring ringing and noisy potentiometers
+// like analysis.h, this only depends on waveform.h, and it only uses static buffers
+
+#ifndef GTS_SPECTRUM_H
+#define GTS_SPECTRUM_H
+
+#include <stdint.h>
+
+#include "waveform.h"
+
+#define SPECTRUM_SIZE_LOG2 9
+#define SPECTRUM_SIZE (1 << SPECTRUM_SIZE_LOG2)
+#define SPECTRUM_BINS (SPECTRUM_SIZE / 2)
+// the recording is resampled to one value every SPECTRUM_SAMPLE_US, ~500 Hz is the highest frequency we can see
+#define SPECTRUM_SAMPLE_US 1000
+#define SPECTRUM_BIN_HZ (1000000.0f / (SPECTRUM_SIZE * SPECTRUM_SAMPLE_US))
+// a sine wave with an amplitude of one stick unit, that fills the whole window, has this magnitude
+#define SPECTRUM_MAGNITUDE_ONE 16
+
+typedef struct SpectrumResult {
+	// magnitude of each frequency, bin n is (n * SPECTRUM_BIN_HZ)
+	uint16_t magnitude[SPECTRUM_BINS];
+	// biggest bin, not counting 0 Hz, 0 if there's nothing there
+	int peakBin;
+	// first sample of the window, and how many values of the window came from the recording, the rest is padded
+	int startIndex;
+	int windowSamples;
+} SpectrumResult;
+
+// in-place radix-2 fft over SPECTRUM_SIZE points of q15
+// each stage is scaled down by half so nothing overflows, the output is the actual fft divided by SPECTRUM_SIZE
+// inputs need to be within +-2^14 in magnitude
+void fftFixed(int16_t *real, int16_t *imag);
+
+// what the axis reads every stepUs, starting at the start of startIndex, returns how many values came from the
+// recording, anything after the end of the recording is left alone
+int resampleUniform(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int startIndex, uint32_t stepUs,
+                    int8_t *values, int count);
+
+// magnitude spectrum of SPECTRUM_SIZE values of a single axis, starting at startIndex
+void analyzeSpectrum(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int startIndex,
+                     SpectrumResult *result);
+
+#endif //GTS_SPECTRUM_H
@@ -0,0 +1,114 @@
+//
+// Created on 10/19/26.
+//
+
+// stickmap regions for the coordinate viewer and the 2d plot, compiled to per-quadrant bitmaps
+// the built-in stickmaps are in stickmap.c and plot2dstickmaps.c, in the same format that /GTS/stickmaps.txt is read in
+// like analysis.h, this doesn't depend on ogc
+
+// the format is one statement per line, and anything after a # is ignored
+//   stickmap <name>                   start a new stickmap
+//   desc <text>                       add a line to the stickmap's description, can be empty
+//   units <melee|raw>                 what the stickmap's coordinates are, has to come before its first region
+//   cstick                            the 2d plot also offers the stickmap for the c-stick
+//   region <rrggbb> <rrggbb> <name>   start a new region, with its highlight and text colors, the name can have spaces
+//   mirror <x|y|swap> ...             also add the region's coordinates mirrored left/right (x), up/down (y),
+//                                     or across x = y (swap), for the coordinates after this line
+//   point <x> <y>                     one coordinate
+//   rect <x1> <y1> <x2> <y2>          every coordinate in the rectangle, inclusive
+//   row <y> <x1> <x2> ...             every coordinate from x1 to x2 on row y, for each pair of x values
+// melee units are the default, and are the decimal part of melee units, so 9375 is 0.9375. they have to be
+// multiples of 125. the coordinate viewer shows these.
+// raw units are the stick values the controller sends, from -128 to 127. the 2d plot shows these.
+// negative is left or down. where regions overlap, the later one wins.
+// a stickmap with the same name as an existing one replaces it.
+
+#ifndef GTS_STICKMAP_H
+#define GTS_STICKMAP_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "waveform.h"
+
+enum STICKMAP_UNITS { STICKMAP_UNITS_MELEE, STICKMAP_UNITS_RAW };
+
+// melee units go from 0 to 80 on each axis, with a bitmap for each quadrant that a region has coordinates in
+// coordinates on an axis are in both quadrants on either side of it
+#define STICKMAP_UNIT_MAX 80
+#define STICKMAP_GRID_SIZE (STICKMAP_UNIT_MAX + 1)
+#define STICKMAP_GRID_WORDS (((STICKMAP_GRID_SIZE * STICKMAP_GRID_SIZE) + 31) / 32)
+// raw units go to 128 on the negative side, and 127 on the positive side
+#define STICKMAP_RAW_MAX 128
+#define STICKMAP_RAW_GRID_SIZE (STICKMAP_RAW_MAX + 1)
+#define STICKMAP_RAW_GRID_WORDS (((STICKMAP_RAW_GRID_SIZE * STICKMAP_RAW_GRID_SIZE) + 31) / 32)
+// quadrant bits, for StickmapRegion.quadrants
+#define STICKMAP_QUADRANT_X_NEGATIVE 0b01
+#define STICKMAP_QUADRANT_Y_NEGATIVE 0b10
+// cell index to stickmap units, gridSize is STICKMAP_GRID_SIZE or STICKMAP_RAW_GRID_SIZE
+#define STICKMAP_CELL_X(gridSize, quadrant, cell) \
+	(((cell) / (gridSize)) * (((quadrant) & STICKMAP_QUADRANT_X_NEGATIVE) ? -1 : 1))
+#define STICKMAP_CELL_Y(gridSize, quadrant, cell) \
+	(((cell) % (gridSize)) * (((quadrant) & STICKMAP_QUADRANT_Y_NEGATIVE) ? -1 : 1))
+
+#define STICKMAP_MAX 16
+// including the miss region at index 0
+#define STICKMAP_REGION_MAX 7
+// quadrant bitmaps shared between every stickmap, about 824 bytes each
+// the built-in stickmaps use 14
+#define STICKMAP_QUADRANT_MAX 48
+// same for raw units, about 2 KB each
+// the built-in stickmaps use 103
+#define STICKMAP_RAW_QUADRANT_MAX 128
+// long enough for the left side of the coordinate viewer
+#define STICKMAP_NAME_LEN 21
+#define STICKMAP_DESC_LEN 512
+
+typedef struct StickmapRegion {
+	char name[STICKMAP_NAME_LEN];
+	// highlight, used for the overlay and as the text background
+	uint8_t color[3];
+	uint8_t textColor[3];
+	// coordinates in the region, the ones on an axis are only counted once
+	int cellCount;
+	// index of each quadrant's bitmap, -1 if the region has nothing in that quadrant
+	int16_t quadrants[4];
+} StickmapRegion;
+
+typedef struct Stickmap {
+	char name[STICKMAP_NAME_LEN];
+	char desc[STICKMAP_DESC_LEN];
+	enum STICKMAP_UNITS units;
+	bool cStick;
+	// different for every stickmap that's read, including ones that replace another
+	uint32_t revision;
+	// region 0 is always the miss region, and is never set
+	int regionCount;
+	StickmapRegion regions[STICKMAP_REGION_MAX];
+} Stickmap;
+
+// the 2d plot stickmaps, in plot2dstickmaps.c
+extern const char *BUILTIN_PLOT2D_STICKMAPS;
+
+// builds the built-in stickmaps, only does anything the first time
+void initStickmaps();
+// the coordinate viewer only shows melee stickmaps, and the 2d plot only raw ones, so these only count those
+int getStickmapCount(enum STICKMAP_UNITS units);
+const Stickmap *getStickmap(enum STICKMAP_UNITS units, int index);
+// NULL if there isn't one with that name
+const Stickmap *findStickmap(const char *name);
+
+// reads stickmaps from a file, and adds them after the built-in ones
+// 0 on success, otherwise the line that couldn't be read, and nothing from the file is kept
+int loadStickmapDefinitions(FILE *file);
+
+// the region's bitmap for the quadrant, NULL if it has nothing there
+// the bitmap's size depends on the stickmap's units
+const uint32_t *getStickmapQuadrant(const Stickmap *stickmap, const StickmapRegion *region, int quadrant);
+
+// which region of a melee stickmap the analog stick is in, 0 if none
+int getStickmapRegionIndex(const Stickmap *stickmap, MeleeCoordinates coords);
+// same for a raw stickmap
+int getStickmapRawRegionIndex(const Stickmap *stickmap, int x, int y);
+
+#endif //GTS_STICKMAP_H
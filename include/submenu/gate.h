@@ -10,6 +10,11 @@
 
 #include <stdint.h>
 
+// number of slices the gate outline is split into, each one holds the furthest point reached in it
+#define GATE_OUTLINE_BINS 128
+// samples closer to the origin than this are ignored
+#define GATE_OUTLINE_MIN_RADIUS 16
+
 enum GATE_MENU_STATE { GATE_SETUP, GATE_POST_SETUP, GATE_INSTRUCTIONS };
 enum GATE_STATE { GATE_INIT, GATE_POST_INIT };
 
@@ -18,4 +23,8 @@ void menu_gateMeasureEnd();
 
 void menu_gateMeasureResetData();
 
+// copy the measured outline for a stick into points, as x/y pairs ordered counterclockwise from +x
+// slices that haven't been reached are skipped, returns the number of points
+int getGateOutline(bool cStick, int8_t points[GATE_OUTLINE_BINS][2]);
+
 #endif //GTS_GATE_H
@@ -17,6 +17,8 @@ enum OSC_STATE { PRE_INPUT, POST_INPUT, POST_INPUT_LOCK };
 
 static const uint8_t OSCILLOSCOPE_TEST_LEN = 3;
 enum OSCILLOSCOPE_TEST { SNAPBACK, PIVOT, DASHBACK };
+// what the snapback test shows below the waveform, cycled with d-pad down
+enum SNAPBACK_PAGE { SNAPBACK_PAGE_MIN_MAX, SNAPBACK_PAGE_SETTLE, SNAPBACK_PAGE_RINGING, SNAPBACK_PAGE_LEN };
 
 void menu_oscilloscope();
 void menu_oscilloscopeEnd();
@@ -12,9 +12,6 @@
 
 #include "waveform.h"
 
-#define IMAGE_LEN 7
-enum IMAGE { NO_IMAGE, DEADZONE, A_WAIT, MOVE_WAIT, CROUCH, LEDGE_L, LEDGE_R  };
-
 enum PLOT_2D_MENU_STATE { PLOT_SETUP, PLOT_POST_SETUP, PLOT_INSTRUCTIONS };
 enum PLOT_2D_STATE { PLOT_DISPLAY, PLOT_INPUT };
 
@@ -12,7 +12,10 @@ enum DATE_CHECK_LIST { DATE_NONE, DATE_AF, DATE_PM, DATE_CMAS };
 
 void forceDate(enum DATE_CHECK_LIST dateToForce);
 
+// only uses the clock (or a date forced from args), so it's safe to call before the filesystem is ready
 enum DATE_CHECK_LIST checkDate();
+// /GTS/color.txt forces DATE_PM, this needs the filesystem
+bool checkDateFile();
 #endif
 
 #endif //GTS_DATETIME_H
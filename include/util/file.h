@@ -6,12 +6,32 @@
 #include <stdio.h>
 
 #include "waveform.h"
+#include "inputevents.h"
 
 // generic filesystem utils
+// starts initFilesystem() on another thread, so that it isn't holding up anything else
+void startFilesystemInit();
+// true once initFilesystem() won't have to wait
+bool isFilesystemInitDone();
+// inits the filesystem if it hasn't been already, waiting for startFilesystemInit() if it's still running
 bool initFilesystem();
 void deinitFilesystem();
 FILE *openFile(char *filename, char *modes);
+// makes sure /GTS exists
+bool createGTSDirectory();
 
+// also writes what the game would read to _frames.csv next to the recording, 5 if that fails
+// oscilloscope recordings get their snapback results in _snapback.csv too, 6 if that fails
 int exportData();
+// write a gate outline from getGateOutline() to /GTS/gate_<date>.csv
+// 0 on success, 1 if there are no points, same as exportData() otherwise
+int exportGateOutline(int8_t points[][2], int count, bool cStick);
+// write the events still in the detector's buffer to /GTS/events_<date>.csv
+// same return codes as exportGateOutline()
+int exportInputEvents(const InputEventDetector *detector);
+// reads extra stickmaps from /GTS/stickmaps.txt, see stickmap.h for the format
+// -1 if there's no file, otherwise same as loadStickmapDefinitions()
+// the file is only read the first time, after that this returns the same result again
+int importStickmaps();
 
 #endif //GTS_FILE_H
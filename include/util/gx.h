@@ -17,7 +17,9 @@
 #include <stdint.h>
 
 #include "util/datetime.h"
+#include "util/polling.h"
 #include "waveform.h"
+#include "stickmap.h"
 #include "menu.h"
 
 // center of screen, 640x480
@@ -36,11 +38,20 @@
 #define TEXMAP_STICKMAPS GX_TEXMAP3
 #define TEXMAP_STICKOUTLINE GX_TEXMAP4
 #define TEXMAP_P GX_TEXMAP5
+#define TEXMAP_HEATMAP GX_TEXMAP6
 
 // same as above
 #define VTXFMT_PRIMITIVES_INT GX_VTXFMT0
 #define VTXFMT_PRIMITIVES_FLOAT GX_VTXFMT1
 #define VTXFMT_TEXTURES GX_VTXFMT2
+// positions and colors are indices into vertex arrays, see VTX_INDEXED
+#define VTXFMT_INDEXED_GRAPH GX_VTXFMT3
+#define VTXFMT_INDEXED_POINTS GX_VTXFMT4
+// s16 positions with fractional bits, used for graph lines
+// multiply screen coordinates by VTXFMT_FIXED_ONE before sending
+#define VTXFMT_PRIMITIVES_FIXED GX_VTXFMT5
+#define VTXFMT_FIXED_FRAC_BITS 4
+#define VTXFMT_FIXED_ONE (1 << VTXFMT_FIXED_FRAC_BITS)
 
 // normal colors
 // mostly based on ogc/color.h
@@ -61,6 +72,8 @@
 #define GX_COLOR_RED_X (GXColor) {0xFF, 0x20, 0x00, 0xFF}
 #define GX_COLOR_BLUE_Y (GXColor) {0x00, 0x6A, 0xFF, 0xFF}
 #define GX_COLOR_ORANGE (GXColor) {0xFF, 0xA5, 0x00, 0xFF}
+#define GX_COLOR_LIGHTRED_X (GXColor) {0xFF, 0x98, 0x80, 0xFF}
+#define GX_COLOR_LIGHTBLUE_Y (GXColor) {0x80, 0xB4, 0xFF, 0xFF}
 
 // window width for graphing...
 #define WAVEFORM_DISPLAY_WIDTH 500.0
@@ -70,7 +83,8 @@ GXColor GXColorAlpha(GXColor color, uint8_t alpha);
 
 // enum to keep track of the vertex description state
 // this _should_ prevent adding unnecessary config commands? idk
-enum CURRENT_VTX_MODE { VTX_NONE, VTX_PRIMITIVES, VTX_TEXTURES };
+// VTX_INDEXED reads positions and colors from arrays set with GX_SetArray(), instead of from the fifo
+enum CURRENT_VTX_MODE { VTX_NONE, VTX_PRIMITIVES, VTX_TEXTURES, VTX_INDEXED };
 
 // change vertex descriptions to one of the above, specifying the tev combiner op if necessary
 void updateVtxDesc(enum CURRENT_VTX_MODE mode, int tevOp);
@@ -82,8 +96,9 @@ void changeLoadedTexmap(int newTexmap);
 // self-explanatory
 void getCurrentTexmapDims(int *width, int *height);
 
-// update what stickmap texture is loaded into TEXMAP_STICKMAPS
-void changeStickmapTexture(int image);
+// draw a raw stickmap's regions into the texture in TEXMAP_STICKMAPS, one texel per stick coordinate
+// only redrawn when the stickmap is different from last time
+void changeStickmapTexture(const Stickmap *stickmap);
 
 // basic initialization stuff
 void setupGX(GXRModeObj *rmode);
@@ -105,6 +120,13 @@ void finishDraw(void *xfb);
 // this will shift the screen by the specified units by calling GX_SetScissorBoxOffset() during finishDraw()
 void setScreenOffset(int x, int y);
 
+// draws that only depend on where the sticks are can be pushed back to the end of finishDraw(),
+// so they use the newest controller values we can get instead of what was read at the start of the frame
+// the callback is run once, with the z depth and alpha that were set when this was called
+// this needs to be called every frame
+typedef void (*late_latch_draw)(const PADStatus *status);
+void setLateLatchDraw(late_latch_draw draw);
+
 // sets the zDepth for draw() calls going forward
 // will not reset until the beginning of a new frame, or when done manually with either
 // restorePrevDepth() or resetDepth();
@@ -129,6 +151,7 @@ void restorePrevAlpha();
 void resetAlpha();
 
 // basic drawing functions
+// these are batched, see flushPrimitiveBatch()
 void drawLine(int x1, int y1, int x2, int y2, GXColor color);
 
 void drawBox(int x1, int y1, int x2, int y2, GXColor color);
@@ -136,6 +159,57 @@ void drawSolidBox(int x1, int y1, int x2, int y2, GXColor color);
 
 void drawTri(int x1, int y1, int x2, int y2, int x3, int y3, GXColor color);
 
+// send any batched primitives from the above functions
+// this happens automatically in updateVtxDesc() and the other gx.h functions that change state,
+// only needs to be called before using beginPrimitive() or changing gx state directly
+void flushPrimitiveBatch();
+
+// GX_SetLineWidth() and GX_SetPointSize() wrappers that flush the batch first
+// widths and sizes are in 1/6ths of a pixel
+void setLineWidth(uint8_t width);
+void setPointSize(uint8_t size);
+
+// GX_Begin() and GX_CallDispList() wrappers, these are counted in GXFrameStats
+// GX_Begin() shouldn't be used directly
+void beginPrimitive(uint8_t primitive, uint8_t vtxFmt, uint16_t vertexCount);
+void callDisplayList(void *list, uint32_t size);
+
+// gx command volume for one frame
+// gx state commands are only sent if they would actually change something, stateElided is the ones that weren't
+// fifoHighWater is in bytes, and is only measured in BENCH builds
+// graphUs is the cpu time spent in drawGraph(), also only measured in BENCH builds
+typedef struct GXFrameStats {
+	uint32_t vertices;
+	uint32_t batches;
+	uint32_t stateIssued;
+	uint32_t stateElided;
+	uint32_t displayLists;
+	uint32_t fifoHighWater;
+	uint32_t graphUs;
+} GXFrameStats;
+
+// stats from the last frame passed to finishDraw()
+void getGXFrameStats(GXFrameStats *stats);
+
+// time from startDraw() to finishDraw() is checked against RENDER_BUDGET_US every frame
+// if it keeps going over, detail is lowered a step, and raised again once there's been headroom for a while
+// DETAIL_REDUCED: long graphs are decimated, 2d plot points are drawn in two batches instead of per frame
+// DETAIL_MINIMAL: graphs are decimated further, frame markers in the 2d plot and text backgrounds are skipped
+enum RENDER_DETAIL { DETAIL_FULL, DETAIL_REDUCED, DETAIL_MINIMAL, DETAIL_LEN };
+#define RENDER_BUDGET_US ((FRAME_TIME_US * 3) / 4)
+
+typedef struct RenderDetailStats {
+	// frames drawn at each level
+	uint32_t framesAtDetail[DETAIL_LEN];
+	// times detail was lowered
+	uint32_t degradeCount;
+	// startDraw() to finishDraw() of the last frame
+	uint32_t lastDrawUs;
+} RenderDetailStats;
+
+enum RENDER_DETAIL getRenderDetail();
+void getRenderDetailStats(RenderDetailStats *stats);
+
 enum GRAPH_TYPE { GRAPH_STICK, GRAPH_STICK_FULL, GRAPH_TRIGGER };
 // called before drawing a new _type_ of graph
 // ie: the setup() function of a given submenu
@@ -144,8 +218,23 @@ void resetDrawGraph();
 void setDrawGraphStickAxis(enum CONTROLLER_STICK_AXIS axis);
 // sets a 'zero index offset', basically shifts the graph by the specified offset. used for GRAPH_STICK_FULL
 void setDrawGraphIndexOffset(int offset);
+// overlay what the game would read, one value per frame, on GRAPH_STICK and GRAPH_STICK_FULL
+// GRAPH_STICK reads at phaseUs from the start of the recording,
+// GRAPH_STICK_FULL uses the reads marked in the recording, so phaseUs doesn't apply
+// turned off by resetDrawGraph()
+void setDrawGraphGameReads(bool enabled, uint32_t phaseUs);
+// a tick along the bottom of the graph, at the sample with this index in the recording
+typedef struct GraphMarker {
+	int dataIndex;
+	GXColor color;
+} GraphMarker;
+#define GRAPH_MARKER_MAX 64
+// markers has to stay valid until drawGraph(), anything past GRAPH_MARKER_MAX is ignored
+// turned off by resetDrawGraph()
+void setDrawGraphMarkers(const GraphMarker *markers, int count);
 // draw the graph
 // uses 4 z layers, either n-2 -> n+1 or n-1 -> n+2, as well as z=0 (todo, needs to be fixed)
+// the game read overlay goes one layer above the lines, markers go with the frame intervals
 void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen);
 // get the scrollOffset and number of samples visible
 // scaling is handled in drawGraph(), so to get information about the graph, this is needed
@@ -154,6 +243,26 @@ void getGraphDisplayedInfo(int *scrollOffset, int *visibleSamples);
 // scaling is handled in drawGraph(), so to get information about the graph, this is needed
 void getGraphStats(uint64_t *uSecs, int8_t *minX, int8_t *minY, int8_t *maxX, int8_t *maxY, bool *yMag);
 
+// draw stick positions as points straight from a recording's samples, using the samples array as a vertex array
+// the samples are only flushed from cache when the recording's revision changes, so this is cheap for static data
+// points are centered on originX/originY, and are orange if any buttons are pressed, white otherwise
+void startRecordingPoints(ControllerRec *data, enum CONTROLLER_STICK_AXIS axis, int originX, int originY);
+// draw count points starting at index start, can be called multiple times between start and end
+void drawRecordingPoints(int start, int count);
+// same as above, but for a list of indices, all in one draw
+void drawRecordingPointList(const int *indices, int count);
+void endRecordingPoints();
+
+// density heatmap of stick positions, one texel per stick coordinate
+// counts keep adding up until clearHeatmap() is called
+#define HEATMAP_SIZE 256
+void clearHeatmap();
+// add samples start to end - 1 of a recording, for the given stick
+void addHeatmapSamples(ControllerRec *data, enum CONTROLLER_STICK_AXIS axis, int start, int end);
+// draw the heatmap as a single HEATMAP_SIZE x HEATMAP_SIZE quad, with x1/y1 as the top left
+// only the parts of the texture that changed since the last draw are updated
+void drawHeatmap(int x1, int y1, GXColor color);
+
 // set temp rotation for a texture draw
 enum TEX_ROTATE { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
 void rotateTextureForDraw(enum TEX_ROTATE rotation);
@@ -12,12 +12,7 @@
 
 #include <ogc/pad.h>
 
-// 1 frame is ~16.666 ms
-// _technically_ it's supposed to be ~16.683 but timings don't seem to align...
-// i really have no idea here
-#define FRAME_TIME_MS_F 16.666
-#define FRAME_TIME_US 16666
-#define FRAME_TIME_US_F (FRAME_TIME_MS_F * 1000)
+#include "waveform.h"
 
 extern const int FRAME_INTERVAL_MS[];
 
@@ -38,4 +33,16 @@ PADStatus getOriginStatus(enum CONT_PORTS_BITFLAGS port);
 void readController(bool updatePressed);
 bool isControllerConnected(enum CONT_PORTS_BITFLAGS port);
 
+// newest values for port 1, without touching anything readController() keeps track of (pressed buttons, etc)
+// falls back to the values from the last readController() if port 1 can't be read
+void readLatestControllerStatus(PADStatus *status);
+
+// input latency, from when the controller was last read for a frame to when that frame starts being scanned out
+// markFrameQueued() should be called right after VIDEO_Flush(), and measureInputLatency() from the retrace callback
+// this can only see when we read the controller, not when the controller was actually polled
+void markFrameQueued();
+void measureInputLatency();
+// latency of the last frame that made it to the screen, in microseconds
+uint32_t getInputLatencyUs();
+
 #endif //GTS_POLLING_H
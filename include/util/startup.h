@@ -0,0 +1,36 @@
+//
+// Created on 10/19/26.
+//
+
+// timeline of how long each part of startup took, measured from the start of main()
+// the time to the first controller poll is the important one, that's what people are waiting on when swapping
+// controllers in and out
+
+#ifndef GTS_STARTUP_H
+#define GTS_STARTUP_H
+
+#include <stdint.h>
+
+// in the order they normally happen, STARTUP_FILESYSTEM happens in the background and can land anywhere after
+// STARTUP_RECORDINGS
+// STARTUP_TEXTURES is inside setupGX(), when every texture has been set up from the tpl
+enum STARTUP_PHASE { STARTUP_VIDEO, STARTUP_TEXTURES, STARTUP_GX, STARTUP_ARGS, STARTUP_RECORDINGS,
+		STARTUP_FIRST_POLL, STARTUP_FIRST_FRAME, STARTUP_FILESYSTEM, STARTUP_PHASE_LEN };
+
+// call at the very start of main(), everything else is relative to this
+void startStartupTimeline();
+// record that a phase finished, only the first call for a given phase counts
+// safe to call from another thread
+void markStartupPhase(enum STARTUP_PHASE phase);
+// microseconds from startStartupTimeline() to the end of the phase, 0 if it hasn't happened yet
+uint32_t getStartupPhaseUs(enum STARTUP_PHASE phase);
+// true once every phase has been marked
+bool isStartupTimelineDone();
+
+// print each phase, starting at the given row and column
+void drawStartupTimeline(int row, int col);
+// write the timeline to /GTS/startup_<date>.csv
+// 0 on success, otherwise the same return codes as exportData()
+int logStartupTimeline();
+
+#endif //GTS_STARTUP_H
@@ -0,0 +1,27 @@
+//
+// Created on 10/19/26.
+//
+
+// per-menu frame timing and gx command volume, for seeing which menus are closest to the frame budget
+// only used in BENCH builds, see main.c
+
+#ifndef GTS_TELEMETRY_H
+#define GTS_TELEMETRY_H
+
+#include <stdint.h>
+
+#include "menu.h"
+
+// add the last frame to the totals for the given menu
+// both are from the start of the frame, logicUs is until the menu is done, gxUs is until the gp is done drawing
+// gx stats are pulled from getGXFrameStats(), so this needs to be called after finishDraw()
+// when the menu changes, the previous menu's totals are written to the log file
+void recordFrameTelemetry(enum CURRENT_MENU menu, uint32_t logicUs, uint32_t gxUs);
+
+// draw the last frame's numbers, along with the worst frame and number of frames over budget for the current menu
+void drawTelemetryOverlay();
+
+// write anything not yet logged, and close the log file
+void stopTelemetry();
+
+#endif //GTS_TELEMETRY_H
@@ -51,6 +51,13 @@ typedef struct MeleeCoordinates {
 	
 } MeleeCoordinates;
 
+// 1 frame is ~16.666 ms
+// _technically_ it's supposed to be ~16.683 but timings don't seem to align...
+// i really have no idea here
+#define FRAME_TIME_MS_F 16.666
+#define FRAME_TIME_US 16666
+#define FRAME_TIME_US_F (FRAME_TIME_MS_F * 1000)
+
 // allocated/max size of the data array
 #define REC_SAMPLE_MAX 3000
 
@@ -90,6 +97,10 @@ typedef struct ControllerRec {
 	// flag for exporting
 	bool dataExported;
 	
+	// changes whenever the contents of samples are replaced, see markRecordingUpdated()
+	// lets anything that caches data derived from a recording know when to rebuild it
+	uint32_t revision;
+	
 } ControllerRec;
 
 // gives waveform.c a pointer to continuous's ControllerRec
@@ -118,6 +129,12 @@ void clearRecordingArray(ControllerRec *recording);
 // allows menus to get a double pointer and not have to change them in each menu
 void flipData();
 
+// gives the recording a new revision number
+// called by clearRecordingArray() and flipData(), anything else that rewrites a displayed recording should call this
+void markRecordingUpdated(ControllerRec *recording);
+// the newest revision given to any recording, changes whenever any recording changes
+uint32_t getLatestRecordingRevision();
+
 enum CONTROLLER_STICK_AXIS { AXIS_AX, AXIS_AY, AXIS_CX, AXIS_CY, AXIS_AXY, AXIS_CXY };
 
 int8_t getControllerSampleAxisValue(ControllerSample sample, enum CONTROLLER_STICK_AXIS axis);
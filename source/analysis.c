@@ -0,0 +1,745 @@
+//
+// Created on 10/19/26.
+//
+
+// Code in use from the PhobGCC project is licensed under GPLv3. A copy of this license is provided in the root
+// directory of this project's repository.
+
+// Upstream URL for the PhobGCC project is: https://github.com/PhobGCC/PhobGCC-SW
+
+#include "analysis.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+// lots of the specific values are taken from:
+// https://github.com/PhobGCC/PhobGCC-doc/blob/main/For_Users/Phobvision_Guide_Latest.md
+
+void initFrameResampler(FrameResampler *resampler, uint32_t phaseUs) {
+	resampler->timeUs = 0;
+	resampler->nextReadUs = phaseUs % FRAME_TIME_US;
+	resampler->sampleCount = 0;
+}
+
+int feedFrameResampler(FrameResampler *resampler, uint64_t timeDiffUs) {
+	int64_t sampleStartUs = resampler->timeUs + timeDiffUs;
+	int reads = 0;
+	// a read right at the start of a sample gets the new sample
+	while (resampler->nextReadUs < sampleStartUs) {
+		reads++;
+		resampler->nextReadUs += FRAME_TIME_US;
+	}
+	resampler->timeUs = sampleStartUs;
+	
+	// nothing to read before the first sample
+	if (resampler->sampleCount == 0) {
+		reads = 0;
+	}
+	resampler->sampleCount++;
+	return reads;
+}
+
+int resampleRecording(const ControllerRec *rec, uint32_t phaseUs, int *readIndices, int maxReads) {
+	FrameResampler resampler;
+	initFrameResampler(&resampler, phaseUs);
+	
+	int readCount = 0;
+	for (int i = 0; i < rec->sampleEnd; i++) {
+		int reads = feedFrameResampler(&resampler, rec->samples[i].timeDiffUs);
+		for (int j = 0; j < reads && readCount < maxReads; j++) {
+			readIndices[readCount] = i - 1;
+			readCount++;
+		}
+	}
+	return readCount;
+}
+
+// the game polls the controller once a frame, but we don't know where in the frame that lands
+// so instead of guessing, we try every phase: each game read is moved across one frame together, and
+// we keep track of which sample each read lands on.
+// the outcome can only change when a read crosses the start of a sample, so those crossings are handled in
+// the order they happen, and each outcome is weighted by how much of the frame it covers.
+// reads are kept in a min-heap by the phase of their next crossing, and the classifier works on summaries of
+// runs of reads that can be combined, kept in a segment tree. a crossing only updates the read that moved,
+// so a sweep is O(reads + crossings * log(reads)), and there's about one crossing per sample in the window.
+
+// one game read, and the sample it currently lands on
+typedef struct PhaseRead {
+	// -1 before the recording starts, the stick is assumed to be at the origin then
+	int index;
+	// time the next sample starts, INT64_MAX if this is the last sample
+	int64_t nextUs;
+} PhaseRead;
+
+// what a classifier needs to know about a run of reads, the meaning of each field is up to the classifier
+typedef struct PhaseSummary {
+	int count;
+	int lead;
+	uint8_t flags;
+} PhaseSummary;
+
+// classifies the reads of one phase, as a summary of each read that can be combined in order
+typedef struct PhaseClassifier {
+	// summary of an empty run, combining with it doesn't change anything
+	PhaseSummary empty;
+	// reads on either side that a read's summary looks at
+	int reach;
+	// summary of values[index] on its own
+	PhaseSummary (*summarize)(const int8_t *values, int index, int count, int param);
+	// summary of the reads in left, then the reads in right
+	PhaseSummary (*combine)(PhaseSummary left, PhaseSummary right);
+	// outcome index from the summary of every read
+	int (*getOutcome)(PhaseSummary summary);
+} PhaseClassifier;
+
+// time that a given sample starts, from the start of the recording
+static int64_t getSampleTimeUs(const ControllerRec *rec, int index) {
+	int64_t timeUs = 0;
+	for (int i = 0; i <= index && i < rec->sampleEnd; i++) {
+		timeUs += rec->samples[i].timeDiffUs;
+	}
+	return timeUs;
+}
+
+// move a read forward until it's on the sample that is current at timeUs
+static void seekPhaseRead(const ControllerRec *rec, PhaseRead *read, int64_t timeUs) {
+	while (read->nextUs <= timeUs) {
+		read->index++;
+		if (read->index + 1 >= rec->sampleEnd) {
+			read->nextUs = INT64_MAX;
+		} else {
+			read->nextUs += rec->samples[read->index + 1].timeDiffUs;
+		}
+	}
+}
+
+// everything one sweep works on
+typedef struct PhaseSweep {
+	const PhaseClassifier *classifier;
+	int param;
+	int readCount;
+	int8_t *values;
+	// leaves start at treeSize, node n covers nodes 2n and 2n + 1
+	PhaseSummary *tree;
+	int treeSize;
+	// read indices, ordered by the phase of their next crossing
+	int *heap;
+	int64_t *heapPhase;
+	int heapCount;
+} PhaseSweep;
+
+// redo the summaries of reads first to last, and everything above them in the tree
+static void updatePhaseSummaries(PhaseSweep *sweep, int first, int last) {
+	if (first < 0) {
+		first = 0;
+	}
+	if (last >= sweep->readCount) {
+		last = sweep->readCount - 1;
+	}
+	for (int read = first; read <= last; read++) {
+		sweep->tree[sweep->treeSize + read] = sweep->classifier->summarize(sweep->values, read, sweep->readCount,
+		                                                                   sweep->param);
+	}
+	
+	int firstNode = (sweep->treeSize + first) / 2, lastNode = (sweep->treeSize + last) / 2;
+	while (firstNode > 0) {
+		for (int node = firstNode; node <= lastNode; node++) {
+			sweep->tree[node] = sweep->classifier->combine(sweep->tree[node * 2], sweep->tree[(node * 2) + 1]);
+		}
+		firstNode /= 2;
+		lastNode /= 2;
+	}
+}
+
+static void pushPhaseCrossing(PhaseSweep *sweep, int read, int64_t phase) {
+	int pos = sweep->heapCount;
+	sweep->heapCount++;
+	while (pos > 0 && sweep->heapPhase[(pos - 1) / 2] > phase) {
+		sweep->heap[pos] = sweep->heap[(pos - 1) / 2];
+		sweep->heapPhase[pos] = sweep->heapPhase[(pos - 1) / 2];
+		pos = (pos - 1) / 2;
+	}
+	sweep->heap[pos] = read;
+	sweep->heapPhase[pos] = phase;
+}
+
+static int popPhaseCrossing(PhaseSweep *sweep) {
+	int read = sweep->heap[0];
+	sweep->heapCount--;
+	int lastRead = sweep->heap[sweep->heapCount];
+	int64_t lastPhase = sweep->heapPhase[sweep->heapCount];
+	int pos = 0;
+	while (true) {
+		int child = (pos * 2) + 1;
+		if (child >= sweep->heapCount) {
+			break;
+		}
+		if (child + 1 < sweep->heapCount && sweep->heapPhase[child + 1] < sweep->heapPhase[child]) {
+			child++;
+		}
+		if (sweep->heapPhase[child] >= lastPhase) {
+			break;
+		}
+		sweep->heap[pos] = sweep->heap[child];
+		sweep->heapPhase[pos] = sweep->heapPhase[child];
+		pos = child;
+	}
+	sweep->heap[pos] = lastRead;
+	sweep->heapPhase[pos] = lastPhase;
+	return read;
+}
+
+// sweep the game's poll phase across one frame, first read at firstReadUs + phase
+// outcomeUs gets how many microseconds of the frame each outcome covers, and is expected to be zeroed
+// readCount comes from the length of the recording, so the buffers are sized to it
+// false if they couldn't be allocated, outcomeUs is left alone then
+static bool sweepFramePhase(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int64_t firstReadUs,
+                            int readCount, const PhaseClassifier *classifier, int param, uint32_t *outcomeUs) {
+	PhaseSweep sweep = { .classifier = classifier, .param = param, .readCount = readCount, .treeSize = 1 };
+	while (sweep.treeSize < readCount) {
+		sweep.treeSize *= 2;
+	}
+	PhaseRead *reads = malloc(sizeof(PhaseRead) * readCount);
+	sweep.values = calloc(readCount, sizeof(int8_t));
+	sweep.tree = malloc(sizeof(PhaseSummary) * sweep.treeSize * 2);
+	sweep.heap = malloc(sizeof(int) * readCount);
+	sweep.heapPhase = malloc(sizeof(int64_t) * readCount);
+	bool allocated = (reads != NULL && sweep.values != NULL && sweep.tree != NULL && sweep.heap != NULL &&
+	                  sweep.heapPhase != NULL);
+	
+	if (allocated) {
+		// every read starts from where the previous one landed, since they're in order
+		PhaseRead cursor = { .index = -1, .nextUs = INT64_MAX };
+		if (rec->sampleEnd > 0) {
+			cursor.nextUs = rec->samples[0].timeDiffUs;
+		}
+		for (int i = 0; i < readCount; i++) {
+			int64_t readUs = firstReadUs + ((int64_t) i * FRAME_TIME_US);
+			seekPhaseRead(rec, &cursor, readUs);
+			reads[i] = cursor;
+			sweep.values[i] = (cursor.index < 0) ? 0 : getControllerSampleAxisValue(rec->samples[cursor.index], axis);
+			if (cursor.nextUs != INT64_MAX) {
+				pushPhaseCrossing(&sweep, i, cursor.nextUs - readUs);
+			}
+		}
+		
+		// every summary at once, the padding past readCount is empty
+		for (int i = 0; i < sweep.treeSize; i++) {
+			sweep.tree[sweep.treeSize + i] = (i < readCount) ?
+					classifier->summarize(sweep.values, i, readCount, param) : classifier->empty;
+		}
+		for (int node = sweep.treeSize - 1; node > 0; node--) {
+			sweep.tree[node] = classifier->combine(sweep.tree[node * 2], sweep.tree[(node * 2) + 1]);
+		}
+		
+		int64_t phase = 0;
+		while (phase < FRAME_TIME_US) {
+			int64_t nextPhase = FRAME_TIME_US;
+			if (sweep.heapCount != 0 && sweep.heapPhase[0] < nextPhase) {
+				nextPhase = sweep.heapPhase[0];
+			}
+			outcomeUs[classifier->getOutcome(sweep.tree[1])] += nextPhase - phase;
+			phase = nextPhase;
+			
+			// move every read that crosses here, then update the summaries that can see them
+			while (phase < FRAME_TIME_US && sweep.heapCount != 0 && sweep.heapPhase[0] == phase) {
+				int i = popPhaseCrossing(&sweep);
+				int64_t readUs = firstReadUs + ((int64_t) i * FRAME_TIME_US);
+				seekPhaseRead(rec, &reads[i], readUs + phase);
+				sweep.values[i] = getControllerSampleAxisValue(rec->samples[reads[i].index], axis);
+				if (reads[i].nextUs != INT64_MAX) {
+					pushPhaseCrossing(&sweep, i, reads[i].nextUs - readUs);
+				}
+				updatePhaseSummaries(&sweep, i - classifier->reach, i + classifier->reach);
+			}
+		}
+	}
+	
+	free(reads);
+	free(sweep.values);
+	free(sweep.tree);
+	free(sweep.heap);
+	free(sweep.heapPhase);
+	return allocated;
+}
+
+enum PIVOT_OUTCOME { PIVOT_NO_TURN, PIVOT_PIVOT, PIVOT_DASHBACK, PIVOT_OUTCOME_LEN };
+
+// param is the sign of the second half of the pivot
+// the number of frames the game sees the second half for decides what happens:
+// none is no turn, one is a pivot, and anything more is a dashback
+// count is the length of the first run of second half reads, lead is the run the reads start with
+// open is set if the first run goes to the end, so the run after can add to it
+#define PIVOT_SUMMARY_OPEN 0b01
+// every read is in the second half
+#define PIVOT_SUMMARY_FULL 0b10
+
+static PhaseSummary summarizePivot(const int8_t *values, int index, [[maybe_unused]] int count, int param) {
+	if (values[index] * param >= 64) {
+		return (PhaseSummary) { .count = 1, .lead = 1, .flags = PIVOT_SUMMARY_OPEN | PIVOT_SUMMARY_FULL };
+	}
+	return (PhaseSummary) { 0 };
+}
+
+static PhaseSummary combinePivot(PhaseSummary left, PhaseSummary right) {
+	PhaseSummary summary = { .lead = left.lead };
+	if (left.flags & PIVOT_SUMMARY_FULL) {
+		summary.lead += right.lead;
+		summary.flags |= (right.flags & PIVOT_SUMMARY_FULL);
+	}
+	
+	if (left.count == 0) {
+		summary.count = right.count;
+		summary.flags |= (right.flags & PIVOT_SUMMARY_OPEN);
+	} else if (left.flags & PIVOT_SUMMARY_OPEN) {
+		summary.count = left.count + right.lead;
+		// still open if it went through all of right
+		if (right.flags & PIVOT_SUMMARY_FULL) {
+			summary.flags |= PIVOT_SUMMARY_OPEN;
+		}
+	} else {
+		summary.count = left.count;
+	}
+	return summary;
+}
+
+static int getPivotOutcome(PhaseSummary summary) {
+	if (summary.count == 0) {
+		return PIVOT_NO_TURN;
+	}
+	return (summary.count == 1) ? PIVOT_PIVOT : PIVOT_DASHBACK;
+}
+
+static const PhaseClassifier PIVOT_CLASSIFIER = { .empty = { .flags = PIVOT_SUMMARY_FULL }, .reach = 0,
+		.summarize = summarizePivot, .combine = combinePivot, .getOutcome = getPivotOutcome };
+
+void analyzePivot(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, PivotResult *result) {
+	bool pivotHit80 = false;
+	bool prevPivotHit80 = false;
+	bool leftPivotRange = false;
+	bool prevLeftPivotRange = false;
+	int pivotStartIndex = -1, pivotEndIndex = -1;
+	int pivotStartSign = 0;
+	// start from the back of the list
+	for (int i = rec->sampleEnd - 1; i >= 0; i--) {
+		int8_t curr = getControllerSampleAxisValue(rec->samples[i], axis);
+		// check current coordinate for +-64 (dash threshold)
+		if ((abs(curr) >= 64) && !leftPivotRange) {
+			if (pivotEndIndex == -1) {
+				pivotEndIndex = i;
+			}
+			// pivot input must hit 80 on both sides
+			if (abs(curr) >= 80) {
+				pivotHit80 = true;
+			}
+			// check if we didn't poll between the dash thresholds
+			// (dolphin w/ bad pode)?
+			if (pivotEndIndex != -1 && !leftPivotRange &&
+			    (curr * getControllerSampleAxisValue(rec->samples[pivotEndIndex], axis) < 0)) {
+				leftPivotRange = true;
+				pivotStartIndex = i;
+			}
+		}
+		
+		// are we outside the pivot range and have already logged data of being in range
+		if (pivotEndIndex != -1 && abs(curr) < 64) {
+			leftPivotRange = true;
+			if (pivotStartIndex == -1) {
+				// need the "previous" poll since this one is out of the range
+				pivotStartIndex = i + 1;
+			}
+			if (prevLeftPivotRange || !pivotHit80) {
+				break;
+			}
+		}
+		
+		// look for the initial input
+		if (abs(curr) >= 64 && leftPivotRange) {
+			// used to ensure starting input is from the opposite side
+			if (pivotStartSign == 0) {
+				pivotStartSign = curr;
+			}
+			prevLeftPivotRange = true;
+			if (abs(curr) >= 80) {
+				prevPivotHit80 = true;
+				break;
+			}
+		}
+	}
+	
+	// anything that isn't a pivot counts as a dashback
+	result->valid = false;
+	result->timeInRangeUs = 0;
+	result->noTurnPercent = 0;
+	result->pivotPercent = 0;
+	result->dashbackPercent = 100;
+	
+	// never reached the dash range
+	if (pivotEndIndex == -1) {
+		return;
+	}
+	
+	// phobvision doc says both sides need to hit 80 to succeed
+	// multiplication is to ensure signs are correct
+	int8_t pivotLastValue = getControllerSampleAxisValue(rec->samples[pivotEndIndex], axis);
+	if (!prevPivotHit80 || !pivotHit80 || (pivotLastValue * pivotStartSign >= 0)) {
+		return;
+	}
+	
+	// the second half of the pivot lasts from the start of pivotStartIndex to the start of the sample after
+	// pivotEndIndex, if the recording ends first we just use what we have
+	int64_t windowStartUs = getSampleTimeUs(rec, pivotStartIndex);
+	int64_t windowEndUs = getSampleTimeUs(rec, pivotEndIndex + 1);
+	result->timeInRangeUs = windowEndUs - windowStartUs;
+	
+	// start one frame early so the read before the second half is included,
+	// and go one frame past the end so we see the read after it
+	uint32_t outcomeUs[PIVOT_OUTCOME_LEN] = { 0 };
+	int readCount = (result->timeInRangeUs / FRAME_TIME_US) + 3;
+	if (!sweepFramePhase(rec, axis, windowStartUs - FRAME_TIME_US, readCount, &PIVOT_CLASSIFIER,
+	                     (pivotLastValue < 0) ? -1 : 1, outcomeUs)) {
+		return;
+	}
+	
+	result->valid = true;
+	result->noTurnPercent = (outcomeUs[PIVOT_NO_TURN] * 100.0) / FRAME_TIME_US;
+	result->pivotPercent = (outcomeUs[PIVOT_PIVOT] * 100.0) / FRAME_TIME_US;
+	result->dashbackPercent = (outcomeUs[PIVOT_DASHBACK] * 100.0) / FRAME_TIME_US;
+}
+
+enum DASHBACK_OUTCOME { DASHBACK_SUCCESS, DASHBACK_UCF_SUCCESS, DASHBACK_FAIL, DASHBACK_OUTCOME_LEN };
+
+// any frame the game sees in the slow-turn range [23,63] before the dash range turns the dashback into
+// a slow-turn on vanilla.
+// ucf converts those frames into a dash if the stick moved more than 75 units across the frame before
+// and the frame after (the dash intention check), so it only fails if one of them doesn't.
+// reads from before the recording started are at the origin
+// only the reads before the first one in the dash range count
+#define DASHBACK_SUMMARY_DASH 0b001
+// a slow-turn read, and one that ucf doesn't save
+#define DASHBACK_SUMMARY_SLOW 0b010
+#define DASHBACK_SUMMARY_FAIL 0b100
+
+static PhaseSummary summarizeDashback(const int8_t *values, int index, int count, [[maybe_unused]] int param) {
+	PhaseSummary summary = { 0 };
+	int curr = abs(values[index]);
+	if (curr >= 64) {
+		summary.flags = DASHBACK_SUMMARY_DASH;
+	} else if (curr >= 23) {
+		summary.flags = DASHBACK_SUMMARY_SLOW;
+		// we need both neighbors to check the dash intention
+		if (index == 0 || index + 1 == count ||
+		    abs(values[index - 1] - values[index]) + abs(values[index] - values[index + 1]) <= 75) {
+			summary.flags |= DASHBACK_SUMMARY_FAIL;
+		}
+	}
+	return summary;
+}
+
+static PhaseSummary combineDashback(PhaseSummary left, PhaseSummary right) {
+	if (left.flags & DASHBACK_SUMMARY_DASH) {
+		return left;
+	}
+	return (PhaseSummary) { .flags = left.flags | right.flags };
+}
+
+static int getDashbackOutcome(PhaseSummary summary) {
+	if (summary.flags & DASHBACK_SUMMARY_FAIL) {
+		return DASHBACK_FAIL;
+	}
+	return (summary.flags & DASHBACK_SUMMARY_SLOW) ? DASHBACK_UCF_SUCCESS : DASHBACK_SUCCESS;
+}
+
+// the dash intention check looks at the reads on either side
+static const PhaseClassifier DASHBACK_CLASSIFIER = { .empty = { 0 }, .reach = 1, .summarize = summarizeDashback,
+		.combine = combineDashback, .getOutcome = getDashbackOutcome };
+
+void analyzeDashback(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, DashbackResult *result) {
+	// go forward in list
+	int dashbackStartIndex = -1, dashbackEndIndex = -1;
+	bool stickInDashRange = false;
+	
+	// iterate over the list, find the start and end point where the X axis is in the
+	// slow-turn range [23,63]
+	// we also check if the X axis reaches the dash range (64+)
+	for (int i = 0; i < rec->sampleEnd; i++) {
+		int8_t curr = abs(getControllerSampleAxisValue(rec->samples[i], axis));
+		// is the stick in the dash range?
+		// note that this is independent from the other if
+		if (curr >= 65) {
+			// mark that we did cross that threshold
+			stickInDashRange = true;
+			// did we miss the slow-turn range?
+			if (dashbackStartIndex == -1) {
+				break;
+			}
+		}
+		
+		// is the stick in the slow-turn range
+		if ((curr >= 23 && curr < 64)) {
+			// set this as the first sample that is in slow-turn range
+			if (dashbackStartIndex == -1) {
+				dashbackStartIndex = i;
+			}
+		} else if (dashbackStartIndex != -1) {
+			dashbackEndIndex = i - 1;
+			// stick has left the slow-turn range, there's no need to continue
+			// checking the list
+			break;
+		}
+	}
+	
+	result->startIndex = dashbackStartIndex;
+	result->endIndex = dashbackEndIndex;
+	
+	if (dashbackEndIndex == -1) {
+		result->startIndex = -1;
+		result->timeInRangeUs = 0;
+		// stick did not get polled in slow-turn range, but did get to dash range,
+		// so this should pass???
+		if (stickInDashRange) {
+			result->vanillaPercent = 100;
+			result->ucfPercent = 100;
+		}
+		// stick did not hit dash range, fail
+		else {
+			result->vanillaPercent = 0.0;
+			result->ucfPercent = 0.0;
+		}
+		return;
+	}
+	
+	int64_t windowStartUs = getSampleTimeUs(rec, dashbackStartIndex);
+	int64_t windowEndUs = getSampleTimeUs(rec, dashbackEndIndex + 1);
+	result->timeInRangeUs = windowEndUs - windowStartUs;
+	
+	// same as pivot, one extra read on each side for the dash intention check
+	uint32_t outcomeUs[DASHBACK_OUTCOME_LEN] = { 0 };
+	int readCount = (result->timeInRangeUs / FRAME_TIME_US) + 3;
+	if (!sweepFramePhase(rec, axis, windowStartUs - FRAME_TIME_US, readCount, &DASHBACK_CLASSIFIER, 0, outcomeUs)) {
+		result->vanillaPercent = 0;
+		result->ucfPercent = 0;
+		return;
+	}
+	
+	result->vanillaPercent = (outcomeUs[DASHBACK_SUCCESS] * 100.0) / FRAME_TIME_US;
+	result->ucfPercent = ((outcomeUs[DASHBACK_SUCCESS] + outcomeUs[DASHBACK_UCF_SUCCESS]) * 100.0) / FRAME_TIME_US;
+}
+
+// the stick has to get this far past center for it to count as a zero crossing, so noise at the origin doesn't
+#define SNAPBACK_CROSSING_UNITS 2
+
+// param is the sign of the release, the outcome is the number of reads past the deadzone on the other side
+static PhaseSummary summarizeSnapback(const int8_t *values, int index, [[maybe_unused]] int count, int param) {
+	return (PhaseSummary) { .count = (values[index] * param < -SNAPBACK_DEADZONE) ? 1 : 0 };
+}
+
+static PhaseSummary combineSnapback(PhaseSummary left, PhaseSummary right) {
+	return (PhaseSummary) { .count = left.count + right.count };
+}
+
+static int getSnapbackOutcome(PhaseSummary summary) {
+	return summary.count;
+}
+
+static const PhaseClassifier SNAPBACK_CLASSIFIER = { .empty = { 0 }, .reach = 0, .summarize = summarizeSnapback,
+		.combine = combineSnapback, .getOutcome = getSnapbackOutcome };
+
+void analyzeSnapback(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int settleUnits,
+                     SnapbackResult *result) {
+	result->valid = false;
+	result->releaseValue = 0;
+	result->releaseIndex = -1;
+	result->overshoot = 0;
+	result->settled = false;
+	result->settleTimeUs = 0;
+	result->zeroCrossings = 0;
+	result->ringingHz = 0;
+	result->decayMs = 0;
+	result->deadzoneFramesMax = 0;
+	result->deadzoneFramesAvg = 0;
+	
+	// the release is the last sample at the furthest point from center, everything after it is tracked in the
+	// same pass, and started over whenever the stick gets that far out again
+	int releaseIndex = -1;
+	int releaseMagnitude = 0;
+	int releaseSign = 0;
+	int64_t releaseUs = 0;
+	int overshoot = 0;
+	// start of the first sample back in the settle range, only meaningful while settled is true
+	bool settled = false;
+	int64_t settleUs = 0;
+	// side of center the stick is on, and the zero crossings since the release
+	int side = 0;
+	int crossings = 0;
+	int64_t firstCrossUs = 0, lastCrossUs = 0;
+	// peak of each half-cycle after a crossing, we only need the current one, the first, and the last
+	int lobePeak = 0, firstLobePeak = 0, lastLobePeak = 0;
+	int64_t lobePeakUs = 0, firstLobeUs = 0, lastLobeUs = 0;
+	
+	int64_t timeUs = 0;
+	for (int i = 0; i < rec->sampleEnd; i++) {
+		timeUs += rec->samples[i].timeDiffUs;
+		int curr = getControllerSampleAxisValue(rec->samples[i], axis);
+		
+		if (abs(curr) >= releaseMagnitude && abs(curr) > settleUnits) {
+			releaseIndex = i;
+			releaseMagnitude = abs(curr);
+			releaseSign = (curr < 0) ? -1 : 1;
+			releaseUs = timeUs;
+			overshoot = 0;
+			settled = false;
+			side = releaseSign;
+			crossings = 0;
+			lobePeak = 0;
+			firstLobePeak = 0;
+			lastLobePeak = 0;
+			continue;
+		}
+		if (releaseIndex == -1) {
+			continue;
+		}
+		
+		if (abs(curr) > settleUnits) {
+			settled = false;
+		} else if (!settled) {
+			settled = true;
+			settleUs = timeUs;
+		}
+		
+		if (curr * releaseSign < -overshoot) {
+			overshoot = abs(curr);
+		}
+		
+		if (curr * side < -SNAPBACK_CROSSING_UNITS) {
+			// the half-cycle before the first crossing is the release itself, not ringing
+			if (crossings != 0) {
+				if (firstLobePeak == 0) {
+					firstLobePeak = lobePeak;
+					firstLobeUs = lobePeakUs;
+				}
+				lastLobePeak = lobePeak;
+				lastLobeUs = lobePeakUs;
+			}
+			if (crossings == 0) {
+				firstCrossUs = timeUs;
+			}
+			lastCrossUs = timeUs;
+			crossings++;
+			side = -side;
+			lobePeak = 0;
+		}
+		if (crossings != 0 && abs(curr) > lobePeak) {
+			lobePeak = abs(curr);
+			lobePeakUs = timeUs;
+		}
+	}
+	
+	if (releaseIndex == -1) {
+		return;
+	}
+	
+	// the recording might end partway through the last half-cycle, but its peak is still the best we have
+	if (crossings != 0 && lobePeak > SNAPBACK_CROSSING_UNITS) {
+		if (firstLobePeak == 0) {
+			firstLobePeak = lobePeak;
+			firstLobeUs = lobePeakUs;
+		}
+		lastLobePeak = lobePeak;
+		lastLobeUs = lobePeakUs;
+	}
+	
+	result->valid = true;
+	result->releaseValue = releaseMagnitude * releaseSign;
+	result->releaseIndex = releaseIndex;
+	result->overshoot = overshoot * -releaseSign;
+	result->settled = settled;
+	result->settleTimeUs = (settled ? settleUs : timeUs) - releaseUs;
+	result->zeroCrossings = crossings;
+	
+	// consecutive crossings are half a cycle apart
+	if (crossings >= 2) {
+		result->ringingHz = ((crossings - 1) * 1000000.0) / (2.0 * (lastCrossUs - firstCrossUs));
+	}
+	// assumes the ringing decays exponentially, A(t) = A0 * e^(-t / decay)
+	if (lastLobeUs > firstLobeUs && lastLobePeak < firstLobePeak) {
+		result->decayMs = ((lastLobeUs - firstLobeUs) / 1000.0) / logf((float) firstLobePeak / lastLobePeak);
+	}
+	
+	// every read from the release to the end of the recording, any number of them can be past the deadzone
+	int readCount = ((timeUs - releaseUs) / FRAME_TIME_US) + 1;
+	uint32_t *outcomeUs = calloc(readCount + 1, sizeof(uint32_t));
+	if (outcomeUs == NULL) {
+		return;
+	}
+	if (sweepFramePhase(rec, axis, releaseUs, readCount, &SNAPBACK_CLASSIFIER, releaseSign, outcomeUs)) {
+		float frameSum = 0;
+		for (int i = 0; i <= readCount; i++) {
+			if (outcomeUs[i] != 0) {
+				result->deadzoneFramesMax = i;
+			}
+			frameSum += (float) i * outcomeUs[i];
+		}
+		result->deadzoneFramesAvg = frameSum / FRAME_TIME_US;
+	}
+	free(outcomeUs);
+}
+
+// mostly based on phobvision code:
+// https://github.com/PhobGCC/PhobGCC-SW/blob/main/PhobGCC/rp2040/src/main.cpp#L581
+void analyzePowershield(const ControllerRec *rec, PowershieldResult *result) {
+	result->valid = true;
+	result->digitalPressed = false;
+	result->timeInAnalogRangeUs = 0;
+	result->digitalPercent = 0.0;
+	result->adtPercent = 0.0;
+	result->nonePercent = 0.0;
+	
+	bool rTrigger;
+	switch (rec->recordingType) {
+		case REC_TRIGGER_L:
+			rTrigger = false;
+			break;
+		case REC_TRIGGER_R:
+			rTrigger = true;
+			break;
+		default:
+			result->valid = false;
+			return;
+	}
+	uint16_t digitalMask = rTrigger ? ANALYSIS_TRIGGER_R : ANALYSIS_TRIGGER_L;
+	
+	for (int i = 0; i < rec->sampleEnd; i++) {
+		if (rec->samples[i].buttons & digitalMask) {
+			result->digitalPressed = true;
+			break;
+		}
+		// 43 is the start of melee's analog shield range
+		uint8_t analog = rTrigger ? rec->samples[i].triggerR : rec->samples[i].triggerL;
+		if (analog > 42) {
+			result->timeInAnalogRangeUs += rec->samples[i].timeDiffUs;
+		}
+	}
+	
+	// digital press never occurred
+	if (!result->digitalPressed) {
+		return;
+	}
+	
+	// float representing percent of a frame
+	float analogRangeFrame = (result->timeInAnalogRangeUs / 1000.0) / FRAME_TIME_MS_F;
+	
+	// time before digital press is more than a frame
+	if (analogRangeFrame > 1) {
+		result->adtPercent = 100 * (2 - analogRangeFrame);
+		if (result->adtPercent < 0) {
+			result->adtPercent = 0;
+		}
+		result->nonePercent = 100 - result->adtPercent;
+	// time before digital press is less than/equal to a frame
+	} else {
+		result->digitalPercent = 100 * (1 - analogRangeFrame);
+		result->adtPercent = 100 - result->digitalPercent;
+	}
+}
@@ -0,0 +1,143 @@
+//
+// Created on 10/19/26.
+//
+
+#include "inputevents.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "analysis.h"
+
+static const char *EVENT_NAMES[EVENT_TYPE_LEN] = { "Dash", "Dashback", "Pivot", "Shield Drop", "Wavedash" };
+
+void initInputEventDetector(InputEventDetector *detector, const Stickmap *shieldDropMap) {
+	memset(detector, 0, sizeof(InputEventDetector));
+	detector->shieldDropMap = shieldDropMap;
+	// nothing before the reset counts as a recent dash or jump
+	detector->framesSinceDash = UINT32_MAX;
+	detector->framesSinceJump = INPUT_EVENT_JUMP_FRAMES + 1;
+}
+
+static void addInputEvent(InputEventDetector *detector, enum INPUT_EVENT_TYPE type, int8_t direction,
+                          uint8_t detail, MeleeCoordinates melee, uint32_t sampleNumber) {
+	InputEvent *event = &detector->events[detector->eventCount % INPUT_EVENT_MAX];
+	event->sampleNumber = sampleNumber;
+	event->frame = detector->frame;
+	event->type = type;
+	event->direction = direction;
+	event->detail = detail;
+	event->meleeX = melee.stickXNegative ? -melee.stickXUnit : melee.stickXUnit;
+	event->meleeY = melee.stickYNegative ? -melee.stickYUnit : melee.stickYUnit;
+	detector->eventCount++;
+}
+
+int feedInputEventDetector(InputEventDetector *detector, const ControllerSample *sample, uint32_t sampleNumber) {
+	uint32_t startCount = detector->eventCount;
+	MeleeCoordinates melee = convertStickRawToMelee(*sample);
+	int x = sample->stickX;
+	int8_t xSide = (x < 0) ? -1 : 1;
+	int8_t dashSide = (abs(x) >= INPUT_EVENT_DASH) ? xSide : 0;
+	
+	// a pivot only holds the second side for a single frame, see classifyPivot()
+	if (detector->pivotPending) {
+		detector->pivotPending = false;
+		if (dashSide != detector->dashSide) {
+			detector->events[detector->pivotEvent % INPUT_EVENT_MAX].type = EVENT_PIVOT;
+		}
+	}
+	
+	if (detector->framesSinceDash != UINT32_MAX) {
+		detector->framesSinceDash++;
+	}
+	
+	if (dashSide != 0 && dashSide != detector->prevDashSide) {
+		// only the slow-turn reads right before this, on this side, matter, see classifyDashback()
+		uint8_t slowTurnFrames = (detector->slowTurnSide == dashSide) ? detector->slowTurnFrames : 0;
+		if (detector->dashSide == -dashSide && detector->framesSinceDash <= INPUT_EVENT_TURN_FRAMES) {
+			detector->pivotEvent = detector->eventCount;
+			detector->pivotPending = true;
+			addInputEvent(detector, EVENT_DASHBACK, dashSide, slowTurnFrames, melee, sampleNumber);
+			detector->dashSide = dashSide;
+			detector->framesSinceDash = 0;
+		} else if (slowTurnFrames <= INPUT_EVENT_DASH_SLOW_FRAMES) {
+			addInputEvent(detector, EVENT_DASH, dashSide, slowTurnFrames, melee, sampleNumber);
+			detector->dashSide = dashSide;
+			detector->framesSinceDash = 0;
+		}
+	}
+	
+	if (abs(x) > INPUT_EVENT_DEADZONE && dashSide == 0) {
+		if (detector->slowTurnSide != xSide) {
+			detector->slowTurnSide = xSide;
+			detector->slowTurnFrames = 0;
+		}
+		if (detector->slowTurnFrames != UINT8_MAX) {
+			detector->slowTurnFrames++;
+		}
+	} else {
+		detector->slowTurnSide = 0;
+		detector->slowTurnFrames = 0;
+	}
+	
+	// the shield has to already be up for the stick to drop through it
+	bool shielding = (sample->buttons & (ANALYSIS_TRIGGER_L | ANALYSIS_TRIGGER_R)) ||
+	                 sample->triggerL >= INPUT_EVENT_SHIELD_ANALOG || sample->triggerR >= INPUT_EVENT_SHIELD_ANALOG;
+	int shieldDropRegion = 0;
+	if (detector->shieldDropMap != NULL) {
+		shieldDropRegion = getStickmapRegionIndex(detector->shieldDropMap, melee);
+		if (shielding && detector->prevShielding && shieldDropRegion != 0 && detector->prevShieldDropRegion == 0) {
+			addInputEvent(detector, EVENT_SHIELD_DROP, (abs(x) > INPUT_EVENT_DEADZONE) ? xSide : 0,
+			              shieldDropRegion, melee, sampleNumber);
+		}
+	}
+	
+	// a wavedash needs a jump first, otherwise shielding with the stick down would look the same
+	// a jump is x, y, or the stick going up, and the airdodge has to come after jumpsquat, so not on the same frame
+	bool jump = (sample->buttons & INPUT_EVENT_JUMP_BUTTONS) || sample->stickY >= INPUT_EVENT_TAP_JUMP;
+	if (jump && !detector->prevJump) {
+		detector->framesSinceJump = 0;
+	} else if (detector->framesSinceJump <= INPUT_EVENT_JUMP_FRAMES) {
+		detector->framesSinceJump++;
+	}
+	
+	// airdodges come from the digital press, the angle is whatever the stick is at on that frame
+	bool airdodge = (sample->buttons & (ANALYSIS_TRIGGER_L | ANALYSIS_TRIGGER_R)) != 0;
+	if (airdodge && !detector->prevAirdodge && sample->stickY < -INPUT_EVENT_DEADZONE &&
+	    detector->framesSinceJump != 0 && detector->framesSinceJump <= INPUT_EVENT_JUMP_FRAMES) {
+		addInputEvent(detector, EVENT_WAVEDASH, (abs(x) > INPUT_EVENT_DEADZONE) ? xSide : 0, 0, melee,
+		              sampleNumber);
+	}
+	
+	detector->prevDashSide = dashSide;
+	detector->prevShielding = shielding;
+	detector->prevAirdodge = airdodge;
+	detector->prevJump = jump;
+	detector->prevShieldDropRegion = shieldDropRegion;
+	detector->frame++;
+	return detector->eventCount - startCount;
+}
+
+int getInputEventBufferedCount(const InputEventDetector *detector) {
+	return (detector->eventCount < INPUT_EVENT_MAX) ? detector->eventCount : INPUT_EVENT_MAX;
+}
+
+const InputEvent *getInputEvent(const InputEventDetector *detector, int index) {
+	int count = getInputEventBufferedCount(detector);
+	if (index < 0 || index >= count) {
+		return NULL;
+	}
+	return &detector->events[(detector->eventCount - count + index) % INPUT_EVENT_MAX];
+}
+
+const char *getInputEventName(enum INPUT_EVENT_TYPE type) {
+	if (type >= EVENT_TYPE_LEN) {
+		return "";
+	}
+	return EVENT_NAMES[type];
+}
+
+float getInputEventAngle(const InputEvent *event) {
+	return atan2f(abs(event->meleeY), abs(event->meleeX)) * (180.0f / (float) M_PI);
+}
@@ -10,6 +10,7 @@
 #include "util/print.h"
 #include "util/args.h"
 #include "util/file.h"
+#include "util/startup.h"
 
 #ifdef DEBUGLOG
 #include "util/logging.h"
@@ -22,6 +23,7 @@
 #ifdef BENCH
 #include <string.h>
 #include <ogc/timesupp.h>
+#include "util/telemetry.h"
 #endif
 
 // basic stuff from the template
@@ -35,6 +37,7 @@ static char* resetMessage = "Exiting...";
 
 void retraceCallback(uint32_t retraceCnt) {
 	setSamplingRate();
+	measureInputLatency();
 	
 	// reading fifo and gp status stuff
 	// debugging
@@ -74,6 +77,8 @@ void cleanupBeforeExit() {
 }
 
 int main(int argc, char **argv) {
+	startStartupTimeline();
+	
 	// register power button handler if we're on wii
 	#if defined(HW_RVL)
 	SYS_SetPowerCallback(powerButtonCallback);
@@ -112,8 +117,10 @@ int main(int argc, char **argv) {
 	VIDEO_Flush();
 
 	VIDEO_WaitForFlush();
+	markStartupPhase(STARTUP_VIDEO);
 	
 	setupGX(rmode);
+	markStartupPhase(STARTUP_GX);
 
 	bool normalExit = false;
 	
@@ -241,6 +248,7 @@ int main(int argc, char **argv) {
 		cleanupBeforeExit();
 		return 0;
 	}
+	markStartupPhase(STARTUP_ARGS);
 	
 	// register retrace callback function
 	// VIDEO_Flush() clears our custom xy values, so they're set again here
@@ -248,12 +256,17 @@ int main(int argc, char **argv) {
 	
 	// allocate memory for recording structs
 	initControllerRecStructs();
+	markStartupPhase(STARTUP_RECORDINGS);
 	
 	
 	#ifdef BENCH
 	long long unsigned int time = 0;
 	int gxtime = 0;
 	int us = 0;
+	// startup timeline is shown until we leave the first menu, and logged once everything is done
+	enum CURRENT_MENU startupMenu = menu_getCurrentMenu();
+	bool showStartupTimeline = true;
+	bool startupTimelineLogged = false;
 	#endif
 	
 	// main loop of the program
@@ -279,29 +292,56 @@ int main(int argc, char **argv) {
 			break;
 		}
 		
+		// nothing on screen would change, keep showing the current framebuffer
+		// this also means the gp isn't fighting with controller polling for the bus
+		if (!menu_needsRedraw()) {
+			VIDEO_Flush();
+			VIDEO_WaitForFlush();
+			continue;
+		}
+		
 		startDraw();
 		
+		#ifdef BENCH
+		// menu can change while running, numbers should go to the one that drew this frame
+		enum CURRENT_MENU benchMenu = menu_getCurrentMenu();
+		#endif
+		
 		// run menu
 		normalExit = menu_runMenu();
 		
 		#ifdef BENCH
 		us = ticks_to_microsecs(gettime() - time);
-		setCursorPos(23, 32);
-		printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "LOGIC: %5d | GX: %5d", us, gxtime);
+		// shows the previous frame
+		drawTelemetryOverlay();
+		if (showStartupTimeline && menu_getCurrentMenu() != startupMenu) {
+			showStartupTimeline = false;
+		}
+		if (showStartupTimeline) {
+			drawStartupTimeline(9, 32);
+		}
 		#endif
 		
 		finishDraw(xfb[xfbSwitch]);
+		markStartupPhase(STARTUP_FIRST_FRAME);
 		
 		#ifdef BENCH
 		gxtime = ticks_to_microsecs(gettime() - time);
+		recordFrameTelemetry(benchMenu, us, gxtime);
+		if (!startupTimelineLogged && isStartupTimelineDone()) {
+			logStartupTimeline();
+			startupTimelineLogged = true;
+		}
 		#endif
 		
-		// change framebuffer for next frame
-		xfbSwitch ^= 1;
+		// show what we just drew, and draw into the other framebuffer next frame
+		// this used to switch first, which showed the previous frame and drew over the one being scanned out
 		VIDEO_SetNextFramebuffer(xfb[xfbSwitch]);
+		xfbSwitch ^= 1;
 
 		// Wait for the next frame
 		VIDEO_Flush();
+		markFrameQueued();
 		VIDEO_WaitForFlush();
 	}
 	
@@ -317,6 +357,10 @@ int main(int argc, char **argv) {
 	stopLogging();
 	#endif
 	
+	#ifdef BENCH
+	stopTelemetry();
+	#endif
+	
 	// close filesystem if necessary
 	deinitFilesystem();
 	
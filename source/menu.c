@@ -10,13 +10,13 @@
 
 #include <ogc/pad.h>
 #include <ogc/video.h>
-#include <ogc/lwp.h>
 #include <ogc/libversion.h>
 
 #include "waveform.h"
 #include "util/gx.h"
 #include "util/print.h"
 #include "util/polling.h"
+#include "util/startup.h"
 
 // TODO: these should go away once all menus have been moved to a separate file
 #include "util/file.h"
@@ -94,31 +94,52 @@ static uint8_t thanksPageCounter = 0;
 
 static void menu_mainMenuDraw();
 
-static lwp_t menu_setup_thread = (lwp_t) NULL;
-
+// MENU_INIT is while the filesystem is still coming up in the background, menus run as normal during it
 enum MENU_INIT_STATE { MENU_PRE_INIT, MENU_INIT, MENU_POST_INIT };
 static enum MENU_INIT_STATE menuInit = MENU_PRE_INIT;
 
-// these functions can take multiple frames to complete, so they should happen asynchronously
-void *menu_preSetup(void *args) {
-	#ifndef NO_DATE_CHECK
-	date = checkDate();
-	#endif
-	
-	filesystemInitResult = initFilesystem();
-	
-	menuInit = MENU_POST_INIT;
-	return NULL;
+// dirty tracking, see menu_needsRedraw()
+// set by menus with menu_setFrameStatic(), cleared at the start of every menu_runMenu()
+static bool frameStatic = false;
+// how many static frames in a row have been drawn with the same input
+static int staticFramesDrawn = 0;
+// menu_needsRedraw() had to read the controller, so menu_runMenu() shouldn't do it again
+static bool controllerAlreadyRead = false;
+
+// what the last static frame was drawn with
+static bool lastDrawnConnected = false;
+static uint32_t lastDrawnRevision = 0;
+
+// true if either stick is far enough from neutral that a menu could be doing something with it
+static bool isStickMoved() {
+	return abs(PAD_StickX(0)) > MENU_STICK_THRESHOLD || abs(PAD_StickY(0)) > MENU_STICK_THRESHOLD ||
+	       abs(PAD_SubStickX(0)) > MENU_STICK_THRESHOLD || abs(PAD_SubStickY(0)) > MENU_STICK_THRESHOLD;
 }
 
 // the "main" for the menus
 // other menu functions are called from here
 // this also handles moving between menus and exiting
 bool menu_runMenu() {
-	// spawn a thread for initialization of stuff that might take a bit...
+	// the sd card can take multiple frames to probe, so that happens on another thread (see startFilesystemInit()),
+	// menus don't wait on it, this way the first poll happens as soon as possible
 	if (menuInit == MENU_PRE_INIT) {
+		#ifndef NO_DATE_CHECK
+		date = checkDate();
+		#endif
+		startFilesystemInit();
 		menuInit = MENU_INIT;
-		LWP_CreateThread(&menu_setup_thread, menu_preSetup, NULL, NULL, 2048, LWP_PRIO_NORMAL);
+	}
+	
+	// pick up anything that depended on the filesystem once it's ready
+	// this is done here instead of on the other thread, so nothing changes in the middle of a frame
+	if (menuInit == MENU_INIT && isFilesystemInitDone()) {
+		filesystemInitResult = initFilesystem();
+		#ifndef NO_DATE_CHECK
+		if (checkDateFile()) {
+			date = DATE_PM;
+		}
+		#endif
+		menuInit = MENU_POST_INIT;
 	}
 	
 	if (data == NULL) {
@@ -130,11 +151,6 @@ bool menu_runMenu() {
 		held = getButtonsHeldPtr();
 	}
 	
-	// we're gonna wait for init to finish, graphics flash for some reason if we don't
-	if (menuInit != MENU_POST_INIT) {
-		return false;
-	}
-	
 	// read inputs and origin status
 	// calls ScanPads(), updates *pressed and *held, and checks for origin when a controller is connected/disconnected
 	// normally this function will update *pressed and *held via ButtonsDown() and ButtonsHeld()
@@ -142,7 +158,12 @@ bool menu_runMenu() {
 	// tl;dr each call of ScanPads() will update what buttons are considered pressed/down,
 	// in some menus, we call ScanPads() multiple times per-frame, meaning ButtonsDown() is basically useless.
 	// in this case, we handle setting 'pressed' buttons manually
-	readController(true);
+	if (!controllerAlreadyRead) {
+		readController(true);
+	}
+	controllerAlreadyRead = false;
+	markStartupPhase(STARTUP_FIRST_POLL);
+	frameStatic = false;
 	
 	menu_drawHeader();
 	
@@ -360,6 +381,25 @@ bool menu_runMenu() {
 		bHeldCounter = 0;
 	}
 	
+	// keep track of what this frame was drawn with, for menu_needsRedraw()
+	if (frameStatic) {
+		bool connected = isControllerConnected(CONT_PORT_1);
+		uint32_t revision = getLatestRecordingRevision();
+		if (*pressed != 0 || *held != 0 || isStickMoved()) {
+			// this frame was drawn mid-input, at least one more has to be drawn once the input stops
+			staticFramesDrawn = 0;
+		} else if (connected != lastDrawnConnected || revision != lastDrawnRevision) {
+			// this frame already shows the change
+			staticFramesDrawn = 1;
+		} else {
+			staticFramesDrawn++;
+		}
+		lastDrawnConnected = connected;
+		lastDrawnRevision = revision;
+	} else {
+		staticFramesDrawn = 0;
+	}
+	
 	// exit the program if start is pressed
 	if (*pressed == PAD_BUTTON_START && currentMenu == MAIN_MENU) {
 		return true;
@@ -640,6 +680,12 @@ void menu_fileExport() {
 				case 4:
 					printStr("Failed to create file, file already exists!");
 					break;
+				case 5:
+					printStr("Failed to create game frames file.");
+					break;
+				case 6:
+					printStr("Failed to create snapback file.");
+					break;
 				default:
 					printStr("How did we get here?");
 					break;
@@ -657,6 +703,42 @@ void menu_setCurrentMenu(enum CURRENT_MENU menu) {
 	currentMenu = menu;
 }
 
+enum CURRENT_MENU menu_getCurrentMenu() {
+	return currentMenu;
+}
+
+void menu_setFrameStatic() {
+	frameStatic = true;
+}
+
+bool menu_needsRedraw() {
+	if (!frameStatic || menuInit != MENU_POST_INIT) {
+		return true;
+	}
+	#ifndef NO_DATE_CHECK
+	// special dates can have animations in the header
+	if (date != DATE_NONE) {
+		return true;
+	}
+	#endif
+	
+	// we have to read the controller here to know if anything changed
+	readController(true);
+	controllerAlreadyRead = true;
+	
+	// anything held can be counting up (hold b to exit, c-stick panning, etc), so always redraw for that
+	if (*pressed != 0 || *held != 0 || isStickMoved()) {
+		return true;
+	}
+	
+	if (isControllerConnected(CONT_PORT_1) != lastDrawnConnected || getLatestRecordingRevision() != lastDrawnRevision) {
+		return true;
+	}
+	
+	// the static frame needs to have been drawn (and shown) once before we stop drawing
+	return staticFramesDrawn < 1;
+}
+
 // self-explanatory
 void menu_thanksPage() {
 	printStr("Thanks to:\n"
@@ -682,4 +764,6 @@ void menu_thanksPage() {
 	printStr(COMMIT_ID);
 	
 	printStr("\n\nLicensed under GNU GPLv3");
+	
+	menu_setFrameStatic();
 }
@@ -0,0 +1,2008 @@
+//
+// Created on 10/19/26.
+//
+
+// the 2d plot stickmaps, in the format from stickmap.h
+// these were the PhobGCC stickmap images (PhobGCC/rp2040/include/images/ in https://github.com/phobgcc/phobgcc-sw),
+// converted with one region per shade of gray. the images don't say what the shades mean, so the regions are
+// named after them, darkest first. the images had no column for x = -128, so nothing is there.
+
+#include "stickmap.h"
+
+const char *BUILTIN_PLOT2D_STICKMAPS =
+		"stickmap Deadzones\n"
+		"desc From PhobGCC's deadzone image\n"
+		"units raw\n"
+		"cstick\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"mirror x y\n"
+		"rect 23 54 59 53\n"
+		"rect 23 48 64 47\n"
+		"rect 23 45 66 44\n"
+		"rect 23 42 68 41\n"
+		"rect 23 40 69 39\n"
+		"rect 23 38 70 37\n"
+		"rect 23 36 71 35\n"
+		"rect 23 34 72 33\n"
+		"rect 23 32 73 31\n"
+		"rect 23 30 74 28\n"
+		"rect 23 27 75 25\n"
+		"rect 23 24 76 23\n"
+		"rect 0 22 22 1\n"
+		"row 76 23 24\n"
+		"row 75 23 27\n"
+		"row 74 23 30\n"
+		"row 73 23 32\n"
+		"row 72 23 34\n"
+		"row 71 23 36\n"
+		"row 70 23 38\n"
+		"row 69 23 40\n"
+		"row 68 23 42\n"
+		"row 67 23 43\n"
+		"row 66 23 45\n"
+		"row 65 23 46\n"
+		"row 64 23 48\n"
+		"row 63 23 49\n"
+		"row 62 23 50\n"
+		"row 61 23 51\n"
+		"row 60 23 52\n"
+		"row 59 23 54\n"
+		"row 58 23 55\n"
+		"row 57 23 56\n"
+		"row 56 23 57\n"
+		"row 55 23 58\n"
+		"row 52 23 60\n"
+		"row 51 23 61\n"
+		"row 50 23 62\n"
+		"row 49 23 63\n"
+		"row 46 23 65\n"
+		"row 43 23 67\n"
+		"row 0 1 22\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"mirror x y\n"
+		"rect 0 126 37 123\n"
+		"rect 0 122 36 120\n"
+		"rect 0 119 35 117\n"
+		"rect 0 116 34 113\n"
+		"rect 0 112 33 110\n"
+		"rect 0 109 32 107\n"
+		"rect 0 106 31 104\n"
+		"rect 0 103 30 100\n"
+		"rect 0 99 29 97\n"
+		"rect 0 96 28 94\n"
+		"rect 0 93 27 90\n"
+		"rect 0 89 26 87\n"
+		"rect 0 86 25 84\n"
+		"rect 0 83 24 81\n"
+		"rect 77 23 127 22\n"
+		"rect 78 21 127 18\n"
+		"rect 79 17 127 13\n"
+		"rect 80 12 127 1\n"
+		"row 127 0 38\n"
+		"row 80 1 24\n"
+		"row 79 13 23\n"
+		"row 78 18 23\n"
+		"row 77 22 23\n"
+		"row 38 127 127\n"
+		"row 37 123 127\n"
+		"row 36 120 127\n"
+		"row 35 117 127\n"
+		"row 34 113 127\n"
+		"row 33 110 127\n"
+		"row 32 107 127\n"
+		"row 31 104 127\n"
+		"row 30 100 127\n"
+		"row 29 97 127\n"
+		"row 28 94 127\n"
+		"row 27 90 127\n"
+		"row 26 87 127\n"
+		"row 25 84 127\n"
+		"row 24 80 127\n"
+		"row 0 81 127\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"mirror x y\n"
+		"rect 0 76 22 23\n"
+		"rect 23 21 77 18\n"
+		"rect 23 17 78 13\n"
+		"rect 23 12 79 1\n"
+		"row 80 0 0\n"
+		"row 79 0 12\n"
+		"row 78 0 17\n"
+		"row 77 0 21\n"
+		"row 22 23 76\n"
+		"row 0 23 80\n"
+
+		"stickmap Wait Attacks\n"
+		"desc From PhobGCC's await image\n"
+		"units raw\n"
+		"cstick\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"rect -59 54 59 53\n"
+		"rect -64 48 -64 47\n"
+		"rect -66 45 -64 44\n"
+		"rect -68 42 -64 41\n"
+		"rect -69 40 -64 39\n"
+		"rect -70 38 -64 37\n"
+		"rect -71 36 -64 35\n"
+		"rect -72 34 -64 33\n"
+		"rect -73 32 -64 31\n"
+		"rect -74 30 -64 28\n"
+		"rect -75 27 -64 25\n"
+		"rect -22 22 22 1\n"
+		"rect -22 -1 22 -22\n"
+		"rect 64 -25 75 -27\n"
+		"rect -75 -25 -64 -27\n"
+		"rect -74 -28 -64 -30\n"
+		"rect 64 -28 74 -30\n"
+		"rect 64 -31 73 -32\n"
+		"rect -73 -31 -64 -32\n"
+		"rect 64 -33 72 -34\n"
+		"rect -72 -33 -64 -34\n"
+		"rect -71 -35 -64 -36\n"
+		"rect 64 -35 71 -36\n"
+		"rect -70 -37 -64 -38\n"
+		"rect 64 -37 70 -38\n"
+		"rect -69 -39 -64 -40\n"
+		"rect 64 -39 69 -40\n"
+		"rect -68 -41 -64 -42\n"
+		"rect 64 -41 68 -42\n"
+		"rect -66 -44 -64 -45\n"
+		"rect 64 -44 66 -45\n"
+		"rect 64 -47 64 -48\n"
+		"rect -64 -47 -64 -48\n"
+		"rect -59 -53 59 -54\n"
+		"row 80 0 0\n"
+		"row 79 -12 12\n"
+		"row 78 -17 17\n"
+		"row 77 -21 21\n"
+		"row 76 -24 24\n"
+		"row 75 -27 27\n"
+		"row 74 -30 30\n"
+		"row 73 -32 32\n"
+		"row 72 -34 34\n"
+		"row 71 -36 36\n"
+		"row 70 -38 38\n"
+		"row 69 -40 40\n"
+		"row 68 -42 42\n"
+		"row 67 -43 43\n"
+		"row 66 -45 45\n"
+		"row 65 -46 46\n"
+		"row 64 -48 48\n"
+		"row 63 -49 49\n"
+		"row 62 -50 50\n"
+		"row 61 -51 51\n"
+		"row 60 -52 52\n"
+		"row 59 -54 54\n"
+		"row 58 -55 55\n"
+		"row 57 -56 56\n"
+		"row 56 -57 57\n"
+		"row 55 -58 58\n"
+		"row 46 -65 -64\n"
+		"row 43 -67 -64\n"
+		"row 24 -76 -64\n"
+		"row 23 -75 -64\n"
+		"row 0 -22 -1 1 22\n"
+		"row -23 -75 -64 64 75\n"
+		"row -24 -76 -64 64 76\n"
+		"row -43 -67 -64 64 67\n"
+		"row -46 -65 -64 64 65\n"
+		"row -55 -58 58\n"
+		"row -56 -57 57\n"
+		"row -57 -56 56\n"
+		"row -58 -55 55\n"
+		"row -59 -54 54\n"
+		"row -60 -52 52\n"
+		"row -61 -51 51\n"
+		"row -62 -50 50\n"
+		"row -63 -49 49\n"
+		"row -64 -48 48\n"
+		"row -65 -46 46\n"
+		"row -66 -45 45\n"
+		"row -67 -43 43\n"
+		"row -68 -42 42\n"
+		"row -69 -40 40\n"
+		"row -70 -38 38\n"
+		"row -71 -36 36\n"
+		"row -72 -34 34\n"
+		"row -73 -32 32\n"
+		"row -74 -30 30\n"
+		"row -75 -27 27\n"
+		"row -76 -24 24\n"
+		"row -77 -21 21\n"
+		"row -78 -17 17\n"
+		"row -79 -12 12\n"
+		"row -80 0 0\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"rect 64 48 64 47\n"
+		"rect 64 45 66 44\n"
+		"rect 64 42 68 41\n"
+		"rect 64 40 69 39\n"
+		"rect 64 38 70 37\n"
+		"rect 64 36 71 35\n"
+		"rect 64 34 72 33\n"
+		"rect 64 32 73 31\n"
+		"rect 64 30 74 28\n"
+		"rect 64 27 75 25\n"
+		"row 46 64 65\n"
+		"row 43 64 67\n"
+		"row 24 64 76\n"
+		"row 23 64 75\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"mirror x y\n"
+		"rect 77 23 127 22\n"
+		"rect 78 21 127 18\n"
+		"rect 79 17 127 13\n"
+		"rect 80 12 127 1\n"
+		"row 112 127 127\n"
+		"row 111 126 127\n"
+		"row 110 125 127\n"
+		"row 109 124 127\n"
+		"row 108 123 127\n"
+		"row 107 122 127\n"
+		"row 106 121 127\n"
+		"row 105 119 127\n"
+		"row 104 118 127\n"
+		"row 103 117 127\n"
+		"row 102 116 127\n"
+		"row 101 115 127\n"
+		"row 100 114 127\n"
+		"row 99 113 127\n"
+		"row 98 112 127\n"
+		"row 97 110 127\n"
+		"row 96 109 127\n"
+		"row 95 108 125\n"
+		"row 94 107 124\n"
+		"row 93 106 123\n"
+		"row 92 105 121\n"
+		"row 91 104 120\n"
+		"row 90 102 119\n"
+		"row 89 101 117\n"
+		"row 88 100 116\n"
+		"row 87 99 115\n"
+		"row 86 98 113\n"
+		"row 85 97 112\n"
+		"row 84 96 111\n"
+		"row 83 95 110\n"
+		"row 82 93 108\n"
+		"row 81 92 107\n"
+		"row 80 91 106\n"
+		"row 79 90 104\n"
+		"row 78 89 103\n"
+		"row 77 88 102\n"
+		"row 76 86 100\n"
+		"row 75 85 99\n"
+		"row 74 84 98\n"
+		"row 73 83 96\n"
+		"row 72 82 95\n"
+		"row 71 81 94\n"
+		"row 70 80 93\n"
+		"row 69 79 91\n"
+		"row 68 77 90\n"
+		"row 67 76 89\n"
+		"row 66 75 87\n"
+		"row 65 74 86\n"
+		"row 64 73 85\n"
+		"row 63 72 83\n"
+		"row 62 71 82\n"
+		"row 61 69 81\n"
+		"row 60 68 79\n"
+		"row 59 67 78\n"
+		"row 58 66 77\n"
+		"row 57 65 75\n"
+		"row 56 64 74\n"
+		"row 55 63 73\n"
+		"row 54 62 71\n"
+		"row 53 60 70\n"
+		"row 52 61 69\n"
+		"row 51 62 67\n"
+		"row 50 63 66\n"
+		"row 49 64 65\n"
+		"row 38 127 127\n"
+		"row 37 123 127\n"
+		"row 36 120 127\n"
+		"row 35 117 127\n"
+		"row 34 113 127\n"
+		"row 33 110 127\n"
+		"row 32 107 127\n"
+		"row 31 104 127\n"
+		"row 30 100 127\n"
+		"row 29 97 127\n"
+		"row 28 94 127\n"
+		"row 27 90 127\n"
+		"row 26 87 127\n"
+		"row 25 84 127\n"
+		"row 24 80 127\n"
+		"row 0 81 127\n"
+		"region 747474 FFFFFF Shade 4\n"
+		"mirror x y\n"
+		"rect 0 50 41 49\n"
+		"rect 0 44 36 43\n"
+		"rect 0 38 31 37\n"
+		"rect 0 32 26 31\n"
+		"rect 0 27 22 23\n"
+		"rect 23 22 63 0\n"
+		"row 52 0 43\n"
+		"row 51 0 42\n"
+		"row 48 0 40\n"
+		"row 47 0 39\n"
+		"row 46 0 38\n"
+		"row 45 0 37\n"
+		"row 42 0 35\n"
+		"row 41 0 34\n"
+		"row 40 0 33\n"
+		"row 39 0 32\n"
+		"row 36 0 30\n"
+		"row 35 0 29\n"
+		"row 34 0 28\n"
+		"row 33 0 27\n"
+		"row 30 0 25\n"
+		"row 29 0 24\n"
+		"row 28 0 23\n"
+		"region 888888 FFFFFF Shade 5\n"
+		"mirror x y\n"
+		"rect 37 44 63 43\n"
+		"rect 32 38 63 37\n"
+		"rect 27 32 63 31\n"
+		"rect 23 27 63 23\n"
+		"rect 64 21 77 18\n"
+		"rect 64 17 78 13\n"
+		"rect 64 12 79 1\n"
+		"row 52 44 60\n"
+		"row 51 43 61\n"
+		"row 50 42 62\n"
+		"row 49 42 63\n"
+		"row 48 41 63\n"
+		"row 47 40 63\n"
+		"row 46 39 63\n"
+		"row 45 38 63\n"
+		"row 42 36 63\n"
+		"row 41 35 63\n"
+		"row 40 34 63 125 127\n"
+		"row 39 33 63 122 127\n"
+		"row 38 119 126\n"
+		"row 37 116 122\n"
+		"row 36 31 63 113 119\n"
+		"row 35 30 63 112 116\n"
+		"row 34 29 63 109 112\n"
+		"row 33 28 63 105 109\n"
+		"row 32 102 106\n"
+		"row 31 99 103\n"
+		"row 30 26 63 96 99\n"
+		"row 29 25 63 93 96\n"
+		"row 28 24 63 90 93\n"
+		"row 27 86 89\n"
+		"row 26 83 86\n"
+		"row 25 80 83\n"
+		"row 24 77 79\n"
+		"row 22 64 76\n"
+		"row 0 64 80\n"
+		"region 9C9C9C FFFFFF Shade 6\n"
+		"mirror x y\n"
+		"row 23 76 76\n"
+
+		"stickmap Wait Movement\n"
+		"desc From PhobGCC's movewait image\n"
+		"units raw\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"mirror x\n"
+		"rect 0 127 127 122\n"
+		"rect 64 42 68 41\n"
+		"rect 64 40 69 39\n"
+		"rect 64 38 70 37\n"
+		"rect 64 36 71 35\n"
+		"rect 64 34 72 33\n"
+		"rect 64 32 73 31\n"
+		"rect 64 30 74 28\n"
+		"rect 64 27 75 25\n"
+		"rect 64 24 76 22\n"
+		"rect 64 21 77 18\n"
+		"rect 64 17 78 13\n"
+		"rect 0 54 22 1\n"
+		"rect 64 12 79 1\n"
+		"rect 64 -1 79 -12\n"
+		"rect 64 -13 78 -17\n"
+		"rect 64 -18 77 -21\n"
+		"rect 64 -22 76 -24\n"
+		"rect 64 -25 75 -27\n"
+		"rect 64 -28 74 -30\n"
+		"rect 64 -31 73 -32\n"
+		"rect 64 -33 72 -34\n"
+		"rect 64 -35 71 -36\n"
+		"rect 64 -37 70 -38\n"
+		"rect 64 -39 69 -40\n"
+		"rect 64 -41 68 -42\n"
+		"rect 64 -44 66 -45\n"
+		"rect 64 -47 64 -48\n"
+		"rect 0 -1 22 -49\n"
+		"rect 23 -53 59 -54\n"
+		"row 121 0 126\n"
+		"row 120 0 125\n"
+		"row 119 0 124\n"
+		"row 118 0 123\n"
+		"row 117 0 122\n"
+		"row 116 0 121\n"
+		"row 115 0 120\n"
+		"row 114 0 119\n"
+		"row 113 0 118\n"
+		"row 112 0 117\n"
+		"row 111 0 116\n"
+		"row 110 0 115\n"
+		"row 109 0 114\n"
+		"row 108 0 113\n"
+		"row 107 0 112\n"
+		"row 106 0 110\n"
+		"row 105 0 109\n"
+		"row 104 0 108\n"
+		"row 103 0 107\n"
+		"row 102 0 106\n"
+		"row 101 0 105\n"
+		"row 100 0 104\n"
+		"row 99 0 103\n"
+		"row 98 0 102\n"
+		"row 97 0 101\n"
+		"row 96 0 100\n"
+		"row 95 0 99 126 127\n"
+		"row 94 0 98 125 127\n"
+		"row 93 0 97 124 127\n"
+		"row 92 0 96 122 127\n"
+		"row 91 0 95 121 127\n"
+		"row 90 0 94 120 127\n"
+		"row 89 0 93 118 127\n"
+		"row 88 0 92 117 127\n"
+		"row 87 0 91 116 127\n"
+		"row 86 0 90 114 125\n"
+		"row 85 0 89 113 124\n"
+		"row 84 0 88 112 123\n"
+		"row 83 0 87 111 121\n"
+		"row 82 0 86 109 120\n"
+		"row 81 0 85 108 118\n"
+		"row 80 1 84 107 117\n"
+		"row 79 13 83 105 115\n"
+		"row 78 18 82 104 114\n"
+		"row 77 22 81 103 112\n"
+		"row 76 25 80 101 111\n"
+		"row 75 28 79 100 109\n"
+		"row 74 31 78 99 108\n"
+		"row 73 33 77 97 106\n"
+		"row 72 35 76 96 105\n"
+		"row 71 37 74 95 103\n"
+		"row 70 39 73 94 102\n"
+		"row 69 41 72 92 101\n"
+		"row 68 43 71 91 99\n"
+		"row 67 44 70 90 98\n"
+		"row 66 46 69 88 97\n"
+		"row 65 47 68 87 95\n"
+		"row 64 49 67 86 94\n"
+		"row 63 50 66 84 92\n"
+		"row 62 51 65 83 91\n"
+		"row 61 52 64 82 89\n"
+		"row 60 53 63 80 88\n"
+		"row 59 55 62 79 86\n"
+		"row 58 56 61 78 85\n"
+		"row 57 57 60 76 83\n"
+		"row 56 58 59 75 82\n"
+		"row 55 74 80\n"
+		"row 54 72 79\n"
+		"row 53 71 77\n"
+		"row 52 70 76\n"
+		"row 51 68 74\n"
+		"row 50 67 73\n"
+		"row 49 66 72\n"
+		"row 48 65 70\n"
+		"row 47 65 69\n"
+		"row 46 66 67\n"
+		"row 44 64 66\n"
+		"row 43 64 67\n"
+		"row 0 1 22 64 80\n"
+		"row -43 64 67\n"
+		"row -46 64 65\n"
+		"row -50 23 62\n"
+		"row -51 23 61\n"
+		"row -52 23 60\n"
+		"row -55 23 58\n"
+		"row -56 23 57\n"
+		"row -58 56 57\n"
+		"row -59 55 58\n"
+		"row -60 53 59\n"
+		"row -61 52 60\n"
+		"row -62 51 61\n"
+		"row -63 50 62\n"
+		"row -64 49 63\n"
+		"row -65 47 64\n"
+		"row -66 46 64\n"
+		"row -67 44 65\n"
+		"row -68 43 66\n"
+		"row -69 41 67\n"
+		"row -70 39 68\n"
+		"row -71 37 69\n"
+		"row -72 35 70\n"
+		"row -73 33 71\n"
+		"row -74 31 72\n"
+		"row -75 28 73\n"
+		"row -76 25 74\n"
+		"row -77 22 75\n"
+		"row -78 18 76\n"
+		"row -79 13 77\n"
+		"row -80 1 78\n"
+		"row -81 0 79\n"
+		"row -82 0 80\n"
+		"row -83 0 81\n"
+		"row -84 0 82\n"
+		"row -85 0 83\n"
+		"row -86 0 84\n"
+		"row -87 0 85\n"
+		"row -88 0 86\n"
+		"row -89 0 87\n"
+		"row -90 0 88\n"
+		"row -91 0 89\n"
+		"row -92 0 90\n"
+		"row -93 0 91\n"
+		"row -94 0 92\n"
+		"row -95 0 93\n"
+		"row -96 0 94\n"
+		"row -97 0 95\n"
+		"row -98 0 96\n"
+		"row -99 0 97\n"
+		"row -100 0 98\n"
+		"row -101 0 99\n"
+		"row -102 0 100\n"
+		"row -103 0 101\n"
+		"row -104 0 102\n"
+		"row -105 0 103\n"
+		"row -106 0 104\n"
+		"row -107 0 105\n"
+		"row -108 0 106\n"
+		"row -109 0 107\n"
+		"row -110 0 108\n"
+		"row -111 0 109\n"
+		"row -112 0 110\n"
+		"row -113 0 111\n"
+		"row -114 0 112\n"
+		"row -115 0 113\n"
+		"row -116 0 114\n"
+		"row -117 0 115\n"
+		"row -118 0 116\n"
+		"row -119 0 117\n"
+		"row -120 0 118\n"
+		"row -121 0 119\n"
+		"row -122 0 120\n"
+		"row -123 0 121\n"
+		"row -124 0 122\n"
+		"row -125 0 123\n"
+		"row -126 0 124\n"
+		"row -127 0 125\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"mirror x\n"
+		"rect 64 48 64 47\n"
+		"row 46 64 65\n"
+		"row 45 64 66\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"mirror x\n"
+		"row 80 0 0\n"
+		"row 79 0 12\n"
+		"row 78 0 17\n"
+		"row 77 0 21\n"
+		"row 76 0 24\n"
+		"row 75 0 27\n"
+		"row 74 0 30\n"
+		"row 73 0 32\n"
+		"row 72 0 34\n"
+		"row 71 0 36\n"
+		"row 70 0 38\n"
+		"row 69 0 40\n"
+		"row 68 0 42\n"
+		"row 67 0 43\n"
+		"row 66 0 45\n"
+		"row 65 0 46\n"
+		"row 64 0 48\n"
+		"row 63 0 49\n"
+		"row 62 0 50\n"
+		"row 61 0 51\n"
+		"row 60 0 52\n"
+		"row 59 0 54\n"
+		"row 58 0 55\n"
+		"row 57 0 56\n"
+		"row 56 0 57\n"
+		"row 55 0 58\n"
+		"row -57 0 56\n"
+		"row -58 0 55\n"
+		"row -59 0 54\n"
+		"row -60 0 52\n"
+		"row -61 0 51\n"
+		"row -62 0 50\n"
+		"row -63 0 49\n"
+		"row -64 0 48\n"
+		"row -65 0 46\n"
+		"row -66 0 45\n"
+		"row -67 0 43\n"
+		"row -68 0 42\n"
+		"row -69 0 40\n"
+		"row -70 0 38\n"
+		"row -71 0 36\n"
+		"row -72 0 34\n"
+		"row -73 0 32\n"
+		"row -74 0 30\n"
+		"row -75 0 27\n"
+		"row -76 0 24\n"
+		"row -77 0 21\n"
+		"row -78 0 17\n"
+		"row -79 0 12\n"
+		"row -80 0 0\n"
+		"region 747474 FFFFFF Shade 4\n"
+		"mirror x\n"
+		"row 121 127 127\n"
+		"row 120 126 127\n"
+		"row 119 125 127\n"
+		"row 118 124 127\n"
+		"row 117 123 127\n"
+		"row 116 122 127\n"
+		"row 115 121 127\n"
+		"row 114 120 127\n"
+		"row 113 119 127\n"
+		"row 112 118 127\n"
+		"row 111 117 127\n"
+		"row 110 116 127\n"
+		"row 109 115 127\n"
+		"row 108 114 127\n"
+		"row 107 113 127\n"
+		"row 106 111 127\n"
+		"row 105 110 127\n"
+		"row 104 109 127\n"
+		"row 103 108 127\n"
+		"row 102 107 127\n"
+		"row 101 106 127\n"
+		"row 100 105 127\n"
+		"row 99 104 127\n"
+		"row 98 103 127\n"
+		"row 97 102 127\n"
+		"row 96 101 127\n"
+		"row 95 100 125\n"
+		"row 94 99 124\n"
+		"row 93 98 123\n"
+		"row 92 97 121\n"
+		"row 91 96 120\n"
+		"row 90 95 119\n"
+		"row 89 94 117\n"
+		"row 88 93 116\n"
+		"row 87 92 115\n"
+		"row 86 91 113\n"
+		"row 85 90 112\n"
+		"row 84 89 111\n"
+		"row 83 88 110\n"
+		"row 82 87 108\n"
+		"row 81 86 107\n"
+		"row 80 85 106\n"
+		"row 79 84 104\n"
+		"row 78 83 103\n"
+		"row 77 82 102\n"
+		"row 76 81 100\n"
+		"row 75 80 99\n"
+		"row 74 79 98\n"
+		"row 73 78 96\n"
+		"row 72 77 95\n"
+		"row 71 75 94\n"
+		"row 70 74 93\n"
+		"row 69 73 91\n"
+		"row 68 72 90\n"
+		"row 67 71 89\n"
+		"row 66 70 87\n"
+		"row 65 69 86\n"
+		"row 64 68 85\n"
+		"row 63 67 83\n"
+		"row 62 66 82\n"
+		"row 61 65 81\n"
+		"row 60 64 79\n"
+		"row 59 63 78\n"
+		"row 58 62 77\n"
+		"row 57 61 75\n"
+		"row 56 60 74\n"
+		"row 55 59 73\n"
+		"row 54 60 71\n"
+		"row 53 60 70\n"
+		"row 52 61 69\n"
+		"row 51 62 67\n"
+		"row 50 63 66\n"
+		"row 49 64 65\n"
+		"row -49 64 65\n"
+		"row -50 63 66\n"
+		"row -51 64 67\n"
+		"row -52 65 69\n"
+		"row -53 67 70\n"
+		"row -54 68 71\n"
+		"row -55 69 73\n"
+		"row -56 70 74\n"
+		"row -57 72 75\n"
+		"row -58 73 77\n"
+		"row -59 74 78\n"
+		"row -60 75 79\n"
+		"row -61 77 81\n"
+		"row -62 78 82\n"
+		"row -63 79 83\n"
+		"row -64 80 85\n"
+		"row -65 82 86\n"
+		"row -66 83 87\n"
+		"row -67 84 89\n"
+		"row -68 85 90\n"
+		"row -69 87 91\n"
+		"row -70 88 93\n"
+		"row -71 89 94\n"
+		"row -72 90 95\n"
+		"row -73 92 96\n"
+		"row -74 93 98\n"
+		"row -75 94 99\n"
+		"row -76 95 100\n"
+		"row -77 96 102\n"
+		"row -78 97 103\n"
+		"row -79 98 104\n"
+		"row -80 99 106\n"
+		"row -81 101 107\n"
+		"row -82 102 108\n"
+		"row -83 103 110\n"
+		"row -84 104 111\n"
+		"row -85 105 112\n"
+		"row -86 107 113\n"
+		"row -87 108 115\n"
+		"row -88 109 116\n"
+		"row -89 110 117\n"
+		"row -90 112 119\n"
+		"row -91 113 120\n"
+		"row -92 114 121\n"
+		"row -93 115 123\n"
+		"row -94 117 124\n"
+		"row -95 118 125\n"
+		"row -96 119 127\n"
+		"row -97 120 127\n"
+		"row -98 122 127\n"
+		"row -99 123 127\n"
+		"row -100 124 127\n"
+		"row -101 125 127\n"
+		"row -102 126 127\n"
+		"region 888888 FFFFFF Shade 5\n"
+		"mirror x\n"
+		"rect 23 54 59 53\n"
+		"rect 23 49 63 -49\n"
+		"rect 0 -50 22 -56\n"
+		"row 52 23 60\n"
+		"row 51 23 61\n"
+		"row 50 23 62\n"
+
+		"stickmap Crouch\n"
+		"desc From PhobGCC's crouch image\n"
+		"units raw\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"mirror x\n"
+		"rect 0 52 22 1\n"
+		"rect 0 -1 22 -49\n"
+		"rect 32 -104 127 -106\n"
+		"rect 33 -107 127 -109\n"
+		"rect 34 -110 127 -112\n"
+		"rect 35 -113 127 -116\n"
+		"rect 36 -117 127 -119\n"
+		"rect 37 -120 127 -122\n"
+		"rect 38 -123 127 -126\n"
+		"row 0 1 22\n"
+		"row -51 62 63\n"
+		"row -52 61 64\n"
+		"row -53 60 66\n"
+		"row -54 60 67\n"
+		"row -55 59 68\n"
+		"row -56 58 69\n"
+		"row -57 57 71\n"
+		"row -58 56 72\n"
+		"row -59 55 73\n"
+		"row -60 53 74\n"
+		"row -61 52 76\n"
+		"row -62 51 77\n"
+		"row -63 50 78\n"
+		"row -64 49 79\n"
+		"row -65 47 81\n"
+		"row -66 46 82\n"
+		"row -67 44 83\n"
+		"row -68 43 84\n"
+		"row -69 41 86\n"
+		"row -70 39 87\n"
+		"row -71 37 88\n"
+		"row -72 35 89\n"
+		"row -73 33 91\n"
+		"row -74 31 92\n"
+		"row -75 28 93\n"
+		"row -76 25 94\n"
+		"row -77 24 95\n"
+		"row -78 24 96\n"
+		"row -79 24 97\n"
+		"row -80 25 98\n"
+		"row -81 25 100\n"
+		"row -82 25 101\n"
+		"row -83 25 102\n"
+		"row -84 26 103\n"
+		"row -85 26 104\n"
+		"row -86 26 106\n"
+		"row -87 27 107\n"
+		"row -88 27 108\n"
+		"row -89 27 109\n"
+		"row -90 28 111\n"
+		"row -91 28 112\n"
+		"row -92 28 113\n"
+		"row -93 28 114\n"
+		"row -94 29 116\n"
+		"row -95 29 117\n"
+		"row -96 29 118\n"
+		"row -97 30 119\n"
+		"row -98 30 121\n"
+		"row -99 30 122\n"
+		"row -100 31 123\n"
+		"row -101 31 124\n"
+		"row -102 31 125\n"
+		"row -103 31 127\n"
+		"row -127 39 127\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"mirror x\n"
+		"rect 64 42 68 41\n"
+		"rect 64 40 69 39\n"
+		"rect 64 38 70 37\n"
+		"rect 64 36 71 35\n"
+		"rect 64 34 72 33\n"
+		"rect 64 32 73 31\n"
+		"rect 64 30 74 28\n"
+		"rect 64 27 75 25\n"
+		"rect 64 24 76 22\n"
+		"rect 64 21 77 18\n"
+		"rect 64 17 78 13\n"
+		"rect 64 12 79 1\n"
+		"rect 64 -1 79 -12\n"
+		"rect 64 -13 78 -17\n"
+		"rect 64 -18 77 -21\n"
+		"rect 64 -22 76 -24\n"
+		"rect 64 -25 75 -27\n"
+		"rect 64 -28 74 -30\n"
+		"rect 64 -31 73 -32\n"
+		"rect 64 -33 72 -34\n"
+		"rect 64 -35 71 -36\n"
+		"rect 64 -37 70 -38\n"
+		"rect 64 -39 69 -40\n"
+		"rect 64 -41 68 -42\n"
+		"rect 64 -44 66 -45\n"
+		"rect 64 -47 64 -48\n"
+		"rect 0 -50 22 -76\n"
+		"row 112 127 127\n"
+		"row 111 126 127\n"
+		"row 110 125 127\n"
+		"row 109 124 127\n"
+		"row 108 123 127\n"
+		"row 107 122 127\n"
+		"row 106 121 127\n"
+		"row 105 119 127\n"
+		"row 104 118 127\n"
+		"row 103 117 127\n"
+		"row 102 116 127\n"
+		"row 101 115 127\n"
+		"row 100 114 127\n"
+		"row 99 113 127\n"
+		"row 98 112 127\n"
+		"row 97 110 127\n"
+		"row 96 109 127\n"
+		"row 95 108 125\n"
+		"row 94 107 124\n"
+		"row 93 106 123\n"
+		"row 92 105 121\n"
+		"row 91 104 120\n"
+		"row 90 102 119\n"
+		"row 89 101 117\n"
+		"row 88 100 116\n"
+		"row 87 99 115\n"
+		"row 86 98 113\n"
+		"row 85 97 112\n"
+		"row 84 96 111\n"
+		"row 83 95 110\n"
+		"row 82 93 108\n"
+		"row 81 92 107\n"
+		"row 80 0 0 91 106\n"
+		"row 79 0 12 90 104\n"
+		"row 78 0 17 89 103\n"
+		"row 77 0 21 88 102\n"
+		"row 76 0 24 86 100\n"
+		"row 75 0 27 85 99\n"
+		"row 74 0 30 84 98\n"
+		"row 73 0 32 83 96\n"
+		"row 72 0 34 82 95\n"
+		"row 71 0 36 81 94\n"
+		"row 70 0 38 80 93\n"
+		"row 69 0 40 79 91\n"
+		"row 68 0 42 77 90\n"
+		"row 67 0 43 76 89\n"
+		"row 66 0 45 75 87\n"
+		"row 65 0 46 74 86\n"
+		"row 64 0 48 73 85\n"
+		"row 63 0 49 72 83\n"
+		"row 62 0 50 71 82\n"
+		"row 61 0 51 69 81\n"
+		"row 60 0 52 68 79\n"
+		"row 59 0 54 67 78\n"
+		"row 58 0 55 66 77\n"
+		"row 57 0 56 65 75\n"
+		"row 56 0 57 64 74\n"
+		"row 55 0 58 63 73\n"
+		"row 54 0 59 62 71\n"
+		"row 53 0 70\n"
+		"row 52 61 69\n"
+		"row 51 62 67\n"
+		"row 50 63 66\n"
+		"row 49 64 65\n"
+		"row 44 64 66\n"
+		"row 43 64 67\n"
+		"row 0 64 80\n"
+		"row -43 64 67\n"
+		"row -46 64 65\n"
+		"row -49 64 65\n"
+		"row -50 63 66\n"
+		"row -51 64 67\n"
+		"row -52 65 69\n"
+		"row -53 67 70\n"
+		"row -54 68 71\n"
+		"row -55 69 73\n"
+		"row -56 70 74\n"
+		"row -57 72 75\n"
+		"row -58 73 77\n"
+		"row -59 74 78\n"
+		"row -60 75 79\n"
+		"row -61 77 81\n"
+		"row -62 78 82\n"
+		"row -63 79 83\n"
+		"row -64 80 85\n"
+		"row -65 82 86\n"
+		"row -66 83 87\n"
+		"row -67 84 89\n"
+		"row -68 85 90\n"
+		"row -69 87 91\n"
+		"row -70 88 93\n"
+		"row -71 89 94\n"
+		"row -72 90 95\n"
+		"row -73 92 96\n"
+		"row -74 93 98\n"
+		"row -75 94 99\n"
+		"row -76 95 100\n"
+		"row -77 0 21 96 102\n"
+		"row -78 0 17 97 103\n"
+		"row -79 0 12 98 104\n"
+		"row -80 0 0 99 106\n"
+		"row -81 101 107\n"
+		"row -82 102 108\n"
+		"row -83 103 110\n"
+		"row -84 104 111\n"
+		"row -85 105 112\n"
+		"row -86 107 113\n"
+		"row -87 108 115\n"
+		"row -88 109 116\n"
+		"row -89 110 117\n"
+		"row -90 112 119\n"
+		"row -91 113 120\n"
+		"row -92 114 121\n"
+		"row -93 115 123\n"
+		"row -94 117 124\n"
+		"row -95 118 125\n"
+		"row -96 119 127\n"
+		"row -97 120 127\n"
+		"row -98 122 127\n"
+		"row -99 123 127\n"
+		"row -100 124 127\n"
+		"row -101 125 127\n"
+		"row -102 126 127\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"mirror x\n"
+		"rect 23 -53 59 -54\n"
+		"row 95 126 127\n"
+		"row 94 125 127\n"
+		"row 93 124 127\n"
+		"row 92 122 127\n"
+		"row 91 121 127\n"
+		"row 90 120 127\n"
+		"row 89 118 127\n"
+		"row 88 117 127\n"
+		"row 87 116 127\n"
+		"row 86 114 125\n"
+		"row 85 113 124\n"
+		"row 84 112 123\n"
+		"row 83 111 121\n"
+		"row 82 109 120\n"
+		"row 81 108 118\n"
+		"row 80 107 117\n"
+		"row 79 105 115\n"
+		"row 78 104 114\n"
+		"row 77 103 112\n"
+		"row 76 101 111\n"
+		"row 75 100 109\n"
+		"row 74 99 108\n"
+		"row 73 97 106\n"
+		"row 72 96 105\n"
+		"row 71 95 103\n"
+		"row 70 94 102\n"
+		"row 69 92 101\n"
+		"row 68 91 99\n"
+		"row 67 90 98\n"
+		"row 66 88 97\n"
+		"row 65 87 95\n"
+		"row 64 86 94\n"
+		"row 63 84 92\n"
+		"row 62 83 91\n"
+		"row 61 82 89\n"
+		"row 60 80 88\n"
+		"row 59 79 86\n"
+		"row 58 78 85\n"
+		"row 57 76 83\n"
+		"row 56 75 82\n"
+		"row 55 74 80\n"
+		"row 54 72 79\n"
+		"row 53 71 77\n"
+		"row 52 70 76\n"
+		"row 51 68 74\n"
+		"row 50 67 73\n"
+		"row 49 66 72\n"
+		"row 48 65 70\n"
+		"row 47 65 69\n"
+		"row 46 66 67\n"
+		"row -50 23 62\n"
+		"row -51 23 61\n"
+		"row -52 23 60\n"
+		"row -55 23 58\n"
+		"row -56 23 57\n"
+		"row -57 23 56\n"
+		"row -58 23 55\n"
+		"row -59 23 54\n"
+		"row -60 23 52\n"
+		"row -61 23 51\n"
+		"row -62 23 50\n"
+		"row -63 23 49\n"
+		"row -64 23 48\n"
+		"row -65 23 46\n"
+		"row -66 23 45\n"
+		"row -67 23 43\n"
+		"row -68 23 42\n"
+		"row -69 23 40\n"
+		"row -70 23 38\n"
+		"row -71 23 36\n"
+		"row -72 23 34\n"
+		"row -73 23 32\n"
+		"row -74 23 30\n"
+		"row -75 23 27\n"
+		"row -76 23 24\n"
+		"region 747474 FFFFFF Shade 4\n"
+		"mirror x\n"
+		"rect 23 49 63 -49\n"
+		"row 52 23 60\n"
+		"row 51 23 61\n"
+		"row 50 23 62\n"
+		"region 888888 FFFFFF Shade 5\n"
+		"mirror x\n"
+		"rect 64 48 64 47\n"
+		"row 46 64 65\n"
+		"row 45 64 66\n"
+
+		"stickmap Left Ledge\n"
+		"desc From PhobGCC's ledge_l image\n"
+		"units raw\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"rect -59 54 59 53\n"
+		"rect -22 22 22 1\n"
+		"rect -22 -1 22 -22\n"
+		"row 80 0 0\n"
+		"row 79 -12 12\n"
+		"row 78 -17 17\n"
+		"row 77 -21 21\n"
+		"row 76 -24 24\n"
+		"row 75 -27 27\n"
+		"row 74 -30 30\n"
+		"row 73 -32 32\n"
+		"row 72 -34 34\n"
+		"row 71 -36 36\n"
+		"row 70 -38 38\n"
+		"row 69 -40 40\n"
+		"row 68 -42 42\n"
+		"row 67 -43 43\n"
+		"row 66 -45 45\n"
+		"row 65 -46 46\n"
+		"row 64 -48 48\n"
+		"row 63 -49 49\n"
+		"row 62 -50 50\n"
+		"row 61 -51 51\n"
+		"row 60 -52 52\n"
+		"row 59 -54 54\n"
+		"row 58 -55 55\n"
+		"row 57 -56 56\n"
+		"row 56 -57 57\n"
+		"row 55 -58 58\n"
+		"row 0 -22 -1 1 22\n"
+		"row -53 -59 44\n"
+		"row -54 -59 45\n"
+		"row -55 -58 46\n"
+		"row -56 -57 46\n"
+		"row -57 -56 47\n"
+		"row -58 -55 48\n"
+		"row -59 -54 49\n"
+		"row -60 -52 50\n"
+		"row -61 -51 51\n"
+		"row -62 -50 50\n"
+		"row -63 -49 49\n"
+		"row -64 -48 48\n"
+		"row -65 -46 46\n"
+		"row -66 -45 45\n"
+		"row -67 -43 43\n"
+		"row -68 -42 42\n"
+		"row -69 -40 40\n"
+		"row -70 -38 38\n"
+		"row -71 -36 36\n"
+		"row -72 -34 34\n"
+		"row -73 -32 32\n"
+		"row -74 -30 30\n"
+		"row -75 -27 27\n"
+		"row -76 -24 24\n"
+		"row -77 -21 21\n"
+		"row -78 -17 17\n"
+		"row -79 -12 12\n"
+		"row -80 0 0\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"mirror y\n"
+		"rect -127 48 -65 47\n"
+		"rect -127 45 -67 44\n"
+		"rect -127 42 -69 41\n"
+		"rect -127 40 -70 39\n"
+		"rect -127 38 -71 37\n"
+		"rect -127 36 -72 35\n"
+		"rect -127 34 -73 33\n"
+		"rect -127 32 -74 31\n"
+		"rect -127 30 -75 28\n"
+		"rect -127 27 -76 25\n"
+		"rect -127 24 -77 22\n"
+		"rect 77 23 127 22\n"
+		"rect 78 21 127 18\n"
+		"rect -127 21 -78 18\n"
+		"rect 79 17 127 13\n"
+		"rect -127 17 -79 13\n"
+		"rect 80 12 127 1\n"
+		"rect -127 12 -80 1\n"
+		"row 112 -127 -127\n"
+		"row 111 -127 -126\n"
+		"row 110 -127 -125\n"
+		"row 109 -127 -124\n"
+		"row 108 -127 -123\n"
+		"row 107 -127 -122\n"
+		"row 106 -127 -121\n"
+		"row 105 -127 -119\n"
+		"row 104 -127 -118\n"
+		"row 103 -127 -117\n"
+		"row 102 -127 -116\n"
+		"row 101 -127 -115\n"
+		"row 100 -127 -114\n"
+		"row 99 -127 -113\n"
+		"row 98 -127 -112\n"
+		"row 97 -127 -110\n"
+		"row 96 -127 -109\n"
+		"row 95 -127 -108\n"
+		"row 94 -127 -107\n"
+		"row 93 -127 -106\n"
+		"row 92 -127 -105\n"
+		"row 91 -127 -104\n"
+		"row 90 -127 -102\n"
+		"row 89 -127 -101\n"
+		"row 88 -127 -100\n"
+		"row 87 -127 -99\n"
+		"row 86 -127 -98\n"
+		"row 85 -127 -97\n"
+		"row 84 -127 -96\n"
+		"row 83 -127 -95\n"
+		"row 82 -127 -93\n"
+		"row 81 -127 -92\n"
+		"row 80 -127 -91\n"
+		"row 79 -127 -90\n"
+		"row 78 -127 -89\n"
+		"row 77 -127 -88\n"
+		"row 76 -127 -86\n"
+		"row 75 -127 -85\n"
+		"row 74 -127 -84\n"
+		"row 73 -127 -83\n"
+		"row 72 -127 -82\n"
+		"row 71 -127 -81\n"
+		"row 70 -127 -80\n"
+		"row 69 -127 -79\n"
+		"row 68 -127 -77\n"
+		"row 67 -127 -76\n"
+		"row 66 -127 -75\n"
+		"row 65 -127 -74\n"
+		"row 64 -127 -73\n"
+		"row 63 -127 -72\n"
+		"row 62 -127 -71\n"
+		"row 61 -127 -69\n"
+		"row 60 -127 -68\n"
+		"row 59 -127 -67\n"
+		"row 58 -127 -66\n"
+		"row 57 -127 -65\n"
+		"row 56 -127 -64\n"
+		"row 55 -127 -63\n"
+		"row 54 -127 -62\n"
+		"row 53 -127 -60\n"
+		"row 52 -127 -61\n"
+		"row 51 -127 -62\n"
+		"row 50 -127 -63\n"
+		"row 49 -127 -64\n"
+		"row 46 -127 -66\n"
+		"row 43 -127 -68\n"
+		"row 38 127 127\n"
+		"row 37 123 127\n"
+		"row 36 120 127\n"
+		"row 35 117 127\n"
+		"row 34 113 127\n"
+		"row 33 110 127\n"
+		"row 32 107 127\n"
+		"row 31 104 127\n"
+		"row 30 100 127\n"
+		"row 29 97 127\n"
+		"row 28 94 127\n"
+		"row 27 90 127\n"
+		"row 26 87 127\n"
+		"row 25 84 127\n"
+		"row 24 80 127\n"
+		"row 0 -127 -81 81 127\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"rect 65 48 127 47\n"
+		"rect 67 45 127 44\n"
+		"rect 69 42 127 41\n"
+		"rect 70 40 127 39\n"
+		"rect 70 -39 127 -40\n"
+		"rect 69 -41 127 -42\n"
+		"rect 67 -44 127 -45\n"
+		"rect 65 -47 127 -48\n"
+		"rect 60 -53 127 -54\n"
+		"rect 57 -66 127 -67\n"
+		"rect 62 -72 127 -73\n"
+		"rect 68 -79 127 -80\n"
+		"rect 73 -85 127 -86\n"
+		"rect 79 -92 127 -93\n"
+		"rect 84 -98 127 -99\n"
+		"rect 89 -104 127 -105\n"
+		"rect 95 -111 127 -112\n"
+		"rect 101 -118 127 -119\n"
+		"rect 106 -124 127 -125\n"
+		"row 112 127 127\n"
+		"row 111 126 127\n"
+		"row 110 125 127\n"
+		"row 109 124 127\n"
+		"row 108 123 127\n"
+		"row 107 122 127\n"
+		"row 106 121 127\n"
+		"row 105 119 127\n"
+		"row 104 118 127\n"
+		"row 103 117 127\n"
+		"row 102 116 127\n"
+		"row 101 115 127\n"
+		"row 100 114 127\n"
+		"row 99 113 127\n"
+		"row 98 112 127\n"
+		"row 97 110 127\n"
+		"row 96 109 127\n"
+		"row 95 108 127\n"
+		"row 94 107 127\n"
+		"row 93 106 127\n"
+		"row 92 105 127\n"
+		"row 91 104 127\n"
+		"row 90 102 127\n"
+		"row 89 101 127\n"
+		"row 88 100 127\n"
+		"row 87 99 127\n"
+		"row 86 98 127\n"
+		"row 85 97 127\n"
+		"row 84 96 127\n"
+		"row 83 95 127\n"
+		"row 82 93 127\n"
+		"row 81 92 127\n"
+		"row 80 91 127\n"
+		"row 79 90 127\n"
+		"row 78 89 127\n"
+		"row 77 88 127\n"
+		"row 76 86 127\n"
+		"row 75 85 127\n"
+		"row 74 84 127\n"
+		"row 73 83 127\n"
+		"row 72 82 127\n"
+		"row 71 81 127\n"
+		"row 70 80 127\n"
+		"row 69 79 127\n"
+		"row 68 77 127\n"
+		"row 67 76 127\n"
+		"row 66 75 127\n"
+		"row 65 74 127\n"
+		"row 64 73 127\n"
+		"row 63 72 127\n"
+		"row 62 71 127\n"
+		"row 61 69 127\n"
+		"row 60 68 127\n"
+		"row 59 67 127\n"
+		"row 58 66 127\n"
+		"row 57 65 127\n"
+		"row 56 64 127\n"
+		"row 55 63 127\n"
+		"row 54 62 127\n"
+		"row 53 60 127\n"
+		"row 52 61 127\n"
+		"row 51 62 127\n"
+		"row 50 63 127\n"
+		"row 49 64 127\n"
+		"row 46 66 127\n"
+		"row 43 68 127\n"
+		"row 38 71 126\n"
+		"row 37 71 122\n"
+		"row 36 72 119\n"
+		"row 35 72 116\n"
+		"row 34 73 112\n"
+		"row 33 73 109\n"
+		"row 32 74 106\n"
+		"row 31 74 103\n"
+		"row 30 75 99\n"
+		"row 29 75 96\n"
+		"row 28 75 93\n"
+		"row 27 76 89\n"
+		"row 26 76 86\n"
+		"row 25 76 83\n"
+		"row 24 77 79\n"
+		"row -24 77 79\n"
+		"row -25 76 83\n"
+		"row -26 76 86\n"
+		"row -27 76 89\n"
+		"row -28 75 93\n"
+		"row -29 75 96\n"
+		"row -30 75 99\n"
+		"row -31 74 103\n"
+		"row -32 74 106\n"
+		"row -33 73 109\n"
+		"row -34 73 112\n"
+		"row -35 72 116\n"
+		"row -36 72 119\n"
+		"row -37 71 122\n"
+		"row -38 71 126\n"
+		"row -43 68 127\n"
+		"row -46 66 127\n"
+		"row -49 64 127\n"
+		"row -50 63 127\n"
+		"row -51 62 127\n"
+		"row -52 61 127\n"
+		"row -55 59 127\n"
+		"row -56 58 127\n"
+		"row -57 57 127\n"
+		"row -58 56 127\n"
+		"row -59 55 127\n"
+		"row -60 53 127\n"
+		"row -61 52 127\n"
+		"row -62 53 127\n"
+		"row -63 54 127\n"
+		"row -64 55 127\n"
+		"row -65 56 127\n"
+		"row -68 58 127\n"
+		"row -69 59 127\n"
+		"row -70 60 127\n"
+		"row -71 61 127\n"
+		"row -74 63 127\n"
+		"row -75 64 127\n"
+		"row -76 65 127\n"
+		"row -77 66 127\n"
+		"row -78 67 127\n"
+		"row -81 69 127\n"
+		"row -82 70 127\n"
+		"row -83 71 127\n"
+		"row -84 72 127\n"
+		"row -87 74 127\n"
+		"row -88 75 127\n"
+		"row -89 76 127\n"
+		"row -90 77 127\n"
+		"row -91 78 127\n"
+		"row -94 80 127\n"
+		"row -95 81 127\n"
+		"row -96 82 127\n"
+		"row -97 83 127\n"
+		"row -100 85 127\n"
+		"row -101 86 127\n"
+		"row -102 87 127\n"
+		"row -103 88 127\n"
+		"row -106 90 127\n"
+		"row -107 91 127\n"
+		"row -108 92 127\n"
+		"row -109 93 127\n"
+		"row -110 94 127\n"
+		"row -113 96 127\n"
+		"row -114 97 127\n"
+		"row -115 98 127\n"
+		"row -116 99 127\n"
+		"row -117 100 127\n"
+		"row -120 102 127\n"
+		"row -121 103 127\n"
+		"row -122 104 127\n"
+		"row -123 105 127\n"
+		"row -126 107 127\n"
+		"row -127 108 127\n"
+		"region 747474 FFFFFF Shade 4\n"
+		"rect -70 38 -32 37\n"
+		"rect -73 32 -27 31\n"
+		"rect -75 27 -23 25\n"
+		"rect -76 24 -23 22\n"
+		"rect -77 21 -23 18\n"
+		"rect 23 21 77 18\n"
+		"rect 23 17 78 13\n"
+		"rect -78 17 -23 13\n"
+		"rect 23 12 79 1\n"
+		"rect -79 12 -23 1\n"
+		"rect 23 -1 79 -12\n"
+		"rect -79 -1 -23 -12\n"
+		"rect 23 -13 78 -17\n"
+		"rect -78 -13 -23 -17\n"
+		"rect -77 -18 -23 -21\n"
+		"rect 23 -18 77 -21\n"
+		"rect -76 -23 22 -24\n"
+		"rect -75 -25 22 -27\n"
+		"rect -73 -31 26 -32\n"
+		"rect -70 -37 31 -38\n"
+		"row 52 -60 -44\n"
+		"row 51 -61 -43\n"
+		"row 50 -62 -42\n"
+		"row 49 -63 -42\n"
+		"row 48 -64 -41\n"
+		"row 47 -64 -40\n"
+		"row 46 -65 -39\n"
+		"row 45 -66 -38\n"
+		"row 44 -66 -37\n"
+		"row 43 -67 -37\n"
+		"row 42 -68 -36\n"
+		"row 41 -68 -35\n"
+		"row 40 -69 -34\n"
+		"row 39 -69 -33\n"
+		"row 36 -71 -31\n"
+		"row 35 -71 -30\n"
+		"row 34 -72 -29\n"
+		"row 33 -72 -28\n"
+		"row 30 -74 -26\n"
+		"row 29 -74 -25\n"
+		"row 28 -74 -24\n"
+		"row 22 23 76\n"
+		"row 0 -80 -23 23 80\n"
+		"row -22 -76 -23 23 76\n"
+		"row -28 -74 23\n"
+		"row -29 -74 24\n"
+		"row -30 -74 25\n"
+		"row -33 -72 27\n"
+		"row -34 -72 28\n"
+		"row -35 -71 29\n"
+		"row -36 -71 30\n"
+		"row -39 -69 32\n"
+		"row -40 -69 33\n"
+		"row -41 -68 34\n"
+		"row -42 -68 35\n"
+		"row -43 -67 36\n"
+		"row -44 -66 36\n"
+		"row -45 -66 37\n"
+		"row -46 -65 38\n"
+		"row -47 -64 39\n"
+		"row -48 -64 40\n"
+		"row -49 -63 41\n"
+		"row -50 -62 41\n"
+		"row -51 -61 42\n"
+		"row -52 -60 43\n"
+		"region 888888 FFFFFF Shade 5\n"
+		"rect -31 38 70 37\n"
+		"rect -26 32 73 31\n"
+		"rect -22 27 75 25\n"
+		"rect -22 24 76 23\n"
+		"rect 23 -23 76 -24\n"
+		"rect 23 -25 75 -27\n"
+		"rect 27 -31 73 -32\n"
+		"rect 32 -37 70 -38\n"
+		"row 52 -43 60\n"
+		"row 51 -42 61\n"
+		"row 50 -41 62\n"
+		"row 49 -41 63\n"
+		"row 48 -40 64\n"
+		"row 47 -39 64\n"
+		"row 46 -38 65\n"
+		"row 45 -37 66\n"
+		"row 44 -36 66\n"
+		"row 43 -36 67\n"
+		"row 42 -35 68\n"
+		"row 41 -34 68\n"
+		"row 40 -33 69\n"
+		"row 39 -32 69\n"
+		"row 36 -30 71\n"
+		"row 35 -29 71\n"
+		"row 34 -28 72\n"
+		"row 33 -27 72\n"
+		"row 30 -25 74\n"
+		"row 29 -24 74\n"
+		"row 28 -23 74\n"
+		"row -28 24 74\n"
+		"row -29 25 74\n"
+		"row -30 26 74\n"
+		"row -33 28 72\n"
+		"row -34 29 72\n"
+		"row -35 30 71\n"
+		"row -36 31 71\n"
+		"row -39 33 69\n"
+		"row -40 34 69\n"
+		"row -41 35 68\n"
+		"row -42 36 68\n"
+		"row -43 37 67\n"
+		"row -44 37 66\n"
+		"row -45 38 66\n"
+		"row -46 39 65\n"
+		"row -47 40 64\n"
+		"row -48 41 64\n"
+		"row -49 42 63\n"
+		"row -50 42 62\n"
+		"row -51 43 61\n"
+		"row -52 44 60\n"
+		"row -53 45 59\n"
+		"row -54 46 59\n"
+		"row -55 47 58\n"
+		"row -56 47 57\n"
+		"row -57 48 56\n"
+		"row -58 49 55\n"
+		"row -59 50 54\n"
+		"row -60 51 52\n"
+
+		"stickmap Right Ledge\n"
+		"desc From PhobGCC's ledge_r image\n"
+		"units raw\n"
+		"region 383838 FFFFFF Shade 1\n"
+		"rect -59 54 59 53\n"
+		"rect -22 22 22 1\n"
+		"rect -22 -1 22 -22\n"
+		"row 80 0 0\n"
+		"row 79 -12 12\n"
+		"row 78 -17 17\n"
+		"row 77 -21 21\n"
+		"row 76 -24 24\n"
+		"row 75 -27 27\n"
+		"row 74 -30 30\n"
+		"row 73 -32 32\n"
+		"row 72 -34 34\n"
+		"row 71 -36 36\n"
+		"row 70 -38 38\n"
+		"row 69 -40 40\n"
+		"row 68 -42 42\n"
+		"row 67 -43 43\n"
+		"row 66 -45 45\n"
+		"row 65 -46 46\n"
+		"row 64 -48 48\n"
+		"row 63 -49 49\n"
+		"row 62 -50 50\n"
+		"row 61 -51 51\n"
+		"row 60 -52 52\n"
+		"row 59 -54 54\n"
+		"row 58 -55 55\n"
+		"row 57 -56 56\n"
+		"row 56 -57 57\n"
+		"row 55 -58 58\n"
+		"row 0 -22 -1 1 22\n"
+		"row -53 -44 59\n"
+		"row -54 -45 59\n"
+		"row -55 -46 58\n"
+		"row -56 -46 57\n"
+		"row -57 -47 56\n"
+		"row -58 -48 55\n"
+		"row -59 -49 54\n"
+		"row -60 -50 52\n"
+		"row -61 -51 51\n"
+		"row -62 -50 50\n"
+		"row -63 -49 49\n"
+		"row -64 -48 48\n"
+		"row -65 -46 46\n"
+		"row -66 -45 45\n"
+		"row -67 -43 43\n"
+		"row -68 -42 42\n"
+		"row -69 -40 40\n"
+		"row -70 -38 38\n"
+		"row -71 -36 36\n"
+		"row -72 -34 34\n"
+		"row -73 -32 32\n"
+		"row -74 -30 30\n"
+		"row -75 -27 27\n"
+		"row -76 -24 24\n"
+		"row -77 -21 21\n"
+		"row -78 -17 17\n"
+		"row -79 -12 12\n"
+		"row -80 0 0\n"
+		"region 4C4C4C FFFFFF Shade 2\n"
+		"mirror y\n"
+		"rect 65 48 127 47\n"
+		"rect 67 45 127 44\n"
+		"rect 69 42 127 41\n"
+		"rect 70 40 127 39\n"
+		"rect 71 38 127 37\n"
+		"rect 72 36 127 35\n"
+		"rect 73 34 127 33\n"
+		"rect 74 32 127 31\n"
+		"rect 75 30 127 28\n"
+		"rect 76 27 127 25\n"
+		"rect 77 24 127 22\n"
+		"rect -127 23 -77 22\n"
+		"rect 78 21 127 18\n"
+		"rect -127 21 -78 18\n"
+		"rect 79 17 127 13\n"
+		"rect -127 17 -79 13\n"
+		"rect 80 12 127 1\n"
+		"rect -127 12 -80 1\n"
+		"row 112 127 127\n"
+		"row 111 126 127\n"
+		"row 110 125 127\n"
+		"row 109 124 127\n"
+		"row 108 123 127\n"
+		"row 107 122 127\n"
+		"row 106 121 127\n"
+		"row 105 119 127\n"
+		"row 104 118 127\n"
+		"row 103 117 127\n"
+		"row 102 116 127\n"
+		"row 101 115 127\n"
+		"row 100 114 127\n"
+		"row 99 113 127\n"
+		"row 98 112 127\n"
+		"row 97 110 127\n"
+		"row 96 109 127\n"
+		"row 95 108 127\n"
+		"row 94 107 127\n"
+		"row 93 106 127\n"
+		"row 92 105 127\n"
+		"row 91 104 127\n"
+		"row 90 102 127\n"
+		"row 89 101 127\n"
+		"row 88 100 127\n"
+		"row 87 99 127\n"
+		"row 86 98 127\n"
+		"row 85 97 127\n"
+		"row 84 96 127\n"
+		"row 83 95 127\n"
+		"row 82 93 127\n"
+		"row 81 92 127\n"
+		"row 80 91 127\n"
+		"row 79 90 127\n"
+		"row 78 89 127\n"
+		"row 77 88 127\n"
+		"row 76 86 127\n"
+		"row 75 85 127\n"
+		"row 74 84 127\n"
+		"row 73 83 127\n"
+		"row 72 82 127\n"
+		"row 71 81 127\n"
+		"row 70 80 127\n"
+		"row 69 79 127\n"
+		"row 68 77 127\n"
+		"row 67 76 127\n"
+		"row 66 75 127\n"
+		"row 65 74 127\n"
+		"row 64 73 127\n"
+		"row 63 72 127\n"
+		"row 62 71 127\n"
+		"row 61 69 127\n"
+		"row 60 68 127\n"
+		"row 59 67 127\n"
+		"row 58 66 127\n"
+		"row 57 65 127\n"
+		"row 56 64 127\n"
+		"row 55 63 127\n"
+		"row 54 62 127\n"
+		"row 53 60 127\n"
+		"row 52 61 127\n"
+		"row 51 62 127\n"
+		"row 50 63 127\n"
+		"row 49 64 127\n"
+		"row 46 66 127\n"
+		"row 43 68 127\n"
+		"row 38 -127 -127\n"
+		"row 37 -127 -123\n"
+		"row 36 -127 -120\n"
+		"row 35 -127 -117\n"
+		"row 34 -127 -113\n"
+		"row 33 -127 -110\n"
+		"row 32 -127 -107\n"
+		"row 31 -127 -104\n"
+		"row 30 -127 -100\n"
+		"row 29 -127 -97\n"
+		"row 28 -127 -94\n"
+		"row 27 -127 -90\n"
+		"row 26 -127 -87\n"
+		"row 25 -127 -84\n"
+		"row 24 -127 -80\n"
+		"row 0 -127 -81 81 127\n"
+		"region 606060 FFFFFF Shade 3\n"
+		"rect -127 48 -65 47\n"
+		"rect -127 45 -67 44\n"
+		"rect -127 42 -69 41\n"
+		"rect -127 40 -70 39\n"
+		"rect -127 -39 -70 -40\n"
+		"rect -127 -41 -69 -42\n"
+		"rect -127 -44 -67 -45\n"
+		"rect -127 -47 -65 -48\n"
+		"rect -127 -53 -60 -54\n"
+		"rect -127 -66 -57 -67\n"
+		"rect -127 -72 -62 -73\n"
+		"rect -127 -79 -68 -80\n"
+		"rect -127 -85 -73 -86\n"
+		"rect -127 -92 -79 -93\n"
+		"rect -127 -98 -84 -99\n"
+		"rect -127 -104 -89 -105\n"
+		"rect -127 -111 -95 -112\n"
+		"rect -127 -118 -101 -119\n"
+		"rect -127 -124 -106 -125\n"
+		"row 112 -127 -127\n"
+		"row 111 -127 -126\n"
+		"row 110 -127 -125\n"
+		"row 109 -127 -124\n"
+		"row 108 -127 -123\n"
+		"row 107 -127 -122\n"
+		"row 106 -127 -121\n"
+		"row 105 -127 -119\n"
+		"row 104 -127 -118\n"
+		"row 103 -127 -117\n"
+		"row 102 -127 -116\n"
+		"row 101 -127 -115\n"
+		"row 100 -127 -114\n"
+		"row 99 -127 -113\n"
+		"row 98 -127 -112\n"
+		"row 97 -127 -110\n"
+		"row 96 -127 -109\n"
+		"row 95 -127 -108\n"
+		"row 94 -127 -107\n"
+		"row 93 -127 -106\n"
+		"row 92 -127 -105\n"
+		"row 91 -127 -104\n"
+		"row 90 -127 -102\n"
+		"row 89 -127 -101\n"
+		"row 88 -127 -100\n"
+		"row 87 -127 -99\n"
+		"row 86 -127 -98\n"
+		"row 85 -127 -97\n"
+		"row 84 -127 -96\n"
+		"row 83 -127 -95\n"
+		"row 82 -127 -93\n"
+		"row 81 -127 -92\n"
+		"row 80 -127 -91\n"
+		"row 79 -127 -90\n"
+		"row 78 -127 -89\n"
+		"row 77 -127 -88\n"
+		"row 76 -127 -86\n"
+		"row 75 -127 -85\n"
+		"row 74 -127 -84\n"
+		"row 73 -127 -83\n"
+		"row 72 -127 -82\n"
+		"row 71 -127 -81\n"
+		"row 70 -127 -80\n"
+		"row 69 -127 -79\n"
+		"row 68 -127 -77\n"
+		"row 67 -127 -76\n"
+		"row 66 -127 -75\n"
+		"row 65 -127 -74\n"
+		"row 64 -127 -73\n"
+		"row 63 -127 -72\n"
+		"row 62 -127 -71\n"
+		"row 61 -127 -69\n"
+		"row 60 -127 -68\n"
+		"row 59 -127 -67\n"
+		"row 58 -127 -66\n"
+		"row 57 -127 -65\n"
+		"row 56 -127 -64\n"
+		"row 55 -127 -63\n"
+		"row 54 -127 -62\n"
+		"row 53 -127 -60\n"
+		"row 52 -127 -61\n"
+		"row 51 -127 -62\n"
+		"row 50 -127 -63\n"
+		"row 49 -127 -64\n"
+		"row 46 -127 -66\n"
+		"row 43 -127 -68\n"
+		"row 38 -126 -71\n"
+		"row 37 -122 -71\n"
+		"row 36 -119 -72\n"
+		"row 35 -116 -72\n"
+		"row 34 -112 -73\n"
+		"row 33 -109 -73\n"
+		"row 32 -106 -74\n"
+		"row 31 -103 -74\n"
+		"row 30 -99 -75\n"
+		"row 29 -96 -75\n"
+		"row 28 -93 -75\n"
+		"row 27 -89 -76\n"
+		"row 26 -86 -76\n"
+		"row 25 -83 -76\n"
+		"row 24 -79 -77\n"
+		"row -24 -79 -77\n"
+		"row -25 -83 -76\n"
+		"row -26 -86 -76\n"
+		"row -27 -89 -76\n"
+		"row -28 -93 -75\n"
+		"row -29 -96 -75\n"
+		"row -30 -99 -75\n"
+		"row -31 -103 -74\n"
+		"row -32 -106 -74\n"
+		"row -33 -109 -73\n"
+		"row -34 -112 -73\n"
+		"row -35 -116 -72\n"
+		"row -36 -119 -72\n"
+		"row -37 -122 -71\n"
+		"row -38 -126 -71\n"
+		"row -43 -127 -68\n"
+		"row -46 -127 -66\n"
+		"row -49 -127 -64\n"
+		"row -50 -127 -63\n"
+		"row -51 -127 -62\n"
+		"row -52 -127 -61\n"
+		"row -55 -127 -59\n"
+		"row -56 -127 -58\n"
+		"row -57 -127 -57\n"
+		"row -58 -127 -56\n"
+		"row -59 -127 -55\n"
+		"row -60 -127 -53\n"
+		"row -61 -127 -52\n"
+		"row -62 -127 -53\n"
+		"row -63 -127 -54\n"
+		"row -64 -127 -55\n"
+		"row -65 -127 -56\n"
+		"row -68 -127 -58\n"
+		"row -69 -127 -59\n"
+		"row -70 -127 -60\n"
+		"row -71 -127 -61\n"
+		"row -74 -127 -63\n"
+		"row -75 -127 -64\n"
+		"row -76 -127 -65\n"
+		"row -77 -127 -66\n"
+		"row -78 -127 -67\n"
+		"row -81 -127 -69\n"
+		"row -82 -127 -70\n"
+		"row -83 -127 -71\n"
+		"row -84 -127 -72\n"
+		"row -87 -127 -74\n"
+		"row -88 -127 -75\n"
+		"row -89 -127 -76\n"
+		"row -90 -127 -77\n"
+		"row -91 -127 -78\n"
+		"row -94 -127 -80\n"
+		"row -95 -127 -81\n"
+		"row -96 -127 -82\n"
+		"row -97 -127 -83\n"
+		"row -100 -127 -85\n"
+		"row -101 -127 -86\n"
+		"row -102 -127 -87\n"
+		"row -103 -127 -88\n"
+		"row -106 -127 -90\n"
+		"row -107 -127 -91\n"
+		"row -108 -127 -92\n"
+		"row -109 -127 -93\n"
+		"row -110 -127 -94\n"
+		"row -113 -127 -96\n"
+		"row -114 -127 -97\n"
+		"row -115 -127 -98\n"
+		"row -116 -127 -99\n"
+		"row -117 -127 -100\n"
+		"row -120 -127 -102\n"
+		"row -121 -127 -103\n"
+		"row -122 -127 -104\n"
+		"row -123 -127 -105\n"
+		"row -126 -127 -107\n"
+		"row -127 -127 -108\n"
+		"region 747474 FFFFFF Shade 4\n"
+		"rect 32 38 70 37\n"
+		"rect 27 32 73 31\n"
+		"rect 23 27 75 25\n"
+		"rect 23 24 76 22\n"
+		"rect -77 21 -23 18\n"
+		"rect 23 21 77 18\n"
+		"rect 23 17 78 13\n"
+		"rect -78 17 -23 13\n"
+		"rect 23 12 79 1\n"
+		"rect -79 12 -23 1\n"
+		"rect 23 -1 79 -12\n"
+		"rect -79 -1 -23 -12\n"
+		"rect 23 -13 78 -17\n"
+		"rect -78 -13 -23 -17\n"
+		"rect -77 -18 -23 -21\n"
+		"rect 23 -18 77 -21\n"
+		"rect -22 -23 76 -24\n"
+		"rect -22 -25 75 -27\n"
+		"rect -26 -31 73 -32\n"
+		"rect -31 -37 70 -38\n"
+		"row 52 44 60\n"
+		"row 51 43 61\n"
+		"row 50 42 62\n"
+		"row 49 42 63\n"
+		"row 48 41 64\n"
+		"row 47 40 64\n"
+		"row 46 39 65\n"
+		"row 45 38 66\n"
+		"row 44 37 66\n"
+		"row 43 37 67\n"
+		"row 42 36 68\n"
+		"row 41 35 68\n"
+		"row 40 34 69\n"
+		"row 39 33 69\n"
+		"row 36 31 71\n"
+		"row 35 30 71\n"
+		"row 34 29 72\n"
+		"row 33 28 72\n"
+		"row 30 26 74\n"
+		"row 29 25 74\n"
+		"row 28 24 74\n"
+		"row 22 -76 -23\n"
+		"row 0 -80 -23 23 80\n"
+		"row -22 -76 -23 23 76\n"
+		"row -28 -23 74\n"
+		"row -29 -24 74\n"
+		"row -30 -25 74\n"
+		"row -33 -27 72\n"
+		"row -34 -28 72\n"
+		"row -35 -29 71\n"
+		"row -36 -30 71\n"
+		"row -39 -32 69\n"
+		"row -40 -33 69\n"
+		"row -41 -34 68\n"
+		"row -42 -35 68\n"
+		"row -43 -36 67\n"
+		"row -44 -36 66\n"
+		"row -45 -37 66\n"
+		"row -46 -38 65\n"
+		"row -47 -39 64\n"
+		"row -48 -40 64\n"
+		"row -49 -41 63\n"
+		"row -50 -41 62\n"
+		"row -51 -42 61\n"
+		"row -52 -43 60\n"
+		"region 888888 FFFFFF Shade 5\n"
+		"rect -70 38 31 37\n"
+		"rect -73 32 26 31\n"
+		"rect -75 27 22 25\n"
+		"rect -76 24 22 23\n"
+		"rect -76 -23 -23 -24\n"
+		"rect -75 -25 -23 -27\n"
+		"rect -73 -31 -27 -32\n"
+		"rect -70 -37 -32 -38\n"
+		"row 52 -60 43\n"
+		"row 51 -61 42\n"
+		"row 50 -62 41\n"
+		"row 49 -63 41\n"
+		"row 48 -64 40\n"
+		"row 47 -64 39\n"
+		"row 46 -65 38\n"
+		"row 45 -66 37\n"
+		"row 44 -66 36\n"
+		"row 43 -67 36\n"
+		"row 42 -68 35\n"
+		"row 41 -68 34\n"
+		"row 40 -69 33\n"
+		"row 39 -69 32\n"
+		"row 36 -71 30\n"
+		"row 35 -71 29\n"
+		"row 34 -72 28\n"
+		"row 33 -72 27\n"
+		"row 30 -74 25\n"
+		"row 29 -74 24\n"
+		"row 28 -74 23\n"
+		"row -28 -74 -24\n"
+		"row -29 -74 -25\n"
+		"row -30 -74 -26\n"
+		"row -33 -72 -28\n"
+		"row -34 -72 -29\n"
+		"row -35 -71 -30\n"
+		"row -36 -71 -31\n"
+		"row -39 -69 -33\n"
+		"row -40 -69 -34\n"
+		"row -41 -68 -35\n"
+		"row -42 -68 -36\n"
+		"row -43 -67 -37\n"
+		"row -44 -66 -37\n"
+		"row -45 -66 -38\n"
+		"row -46 -65 -39\n"
+		"row -47 -64 -40\n"
+		"row -48 -64 -41\n"
+		"row -49 -63 -42\n"
+		"row -50 -62 -42\n"
+		"row -51 -61 -43\n"
+		"row -52 -60 -44\n"
+		"row -53 -59 -45\n"
+		"row -54 -59 -46\n"
+		"row -55 -58 -47\n"
+		"row -56 -57 -47\n"
+		"row -57 -56 -48\n"
+		"row -58 -55 -49\n"
+		"row -59 -54 -50\n"
+		"row -60 -52 -51\n";
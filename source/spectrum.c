@@ -0,0 +1,165 @@
+//
+// Created on 10/19/26.
+//
+
+#include "spectrum.h"
+
+#include <stdint.h>
+#include <math.h>
+
+// q15 twiddle factors, e^(-2*pi*i*k/SPECTRUM_SIZE) for the first half of the circle
+static int16_t twiddleReal[SPECTRUM_BINS];
+static int16_t twiddleImag[SPECTRUM_BINS];
+// q15 hann window, so that the ends of the window don't show up as noise across every frequency
+static int16_t hannWindow[SPECTRUM_SIZE];
+static bool tablesReady = false;
+
+// working buffers, there's only ever one spectrum being worked on
+static int8_t windowValues[SPECTRUM_SIZE];
+static int16_t fftReal[SPECTRUM_SIZE];
+static int16_t fftImag[SPECTRUM_SIZE];
+
+static void initSpectrumTables() {
+	if (tablesReady) {
+		return;
+	}
+	for (int k = 0; k < SPECTRUM_BINS; k++) {
+		float angle = (2.0f * (float) M_PI * k) / SPECTRUM_SIZE;
+		twiddleReal[k] = (int16_t) lroundf(cosf(angle) * 32767.0f);
+		twiddleImag[k] = (int16_t) lroundf(-sinf(angle) * 32767.0f);
+	}
+	for (int i = 0; i < SPECTRUM_SIZE; i++) {
+		float angle = (2.0f * (float) M_PI * i) / (SPECTRUM_SIZE - 1);
+		hannWindow[i] = (int16_t) lroundf((0.5f - (0.5f * cosf(angle))) * 32767.0f);
+	}
+	tablesReady = true;
+}
+
+void fftFixed(int16_t *real, int16_t *imag) {
+	initSpectrumTables();
+	
+	// bit-reversed order, so the butterflies can work in place
+	for (int i = 1, j = 0; i < SPECTRUM_SIZE; i++) {
+		int bit = SPECTRUM_SIZE >> 1;
+		while (j & bit) {
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+		if (i < j) {
+			int16_t temp = real[i];
+			real[i] = real[j];
+			real[j] = temp;
+			temp = imag[i];
+			imag[i] = imag[j];
+			imag[j] = temp;
+		}
+	}
+	
+	// the inputs are within 2^14, and every stage halves, so nothing here can go past 2^15
+	for (int half = 1, stride = SPECTRUM_BINS; half < SPECTRUM_SIZE; half <<= 1, stride >>= 1) {
+		for (int group = 0; group < SPECTRUM_SIZE; group += half << 1) {
+			for (int k = 0; k < half; k++) {
+				int i = group + k;
+				int j = i + half;
+				int32_t wr = twiddleReal[k * stride];
+				int32_t wi = twiddleImag[k * stride];
+				int32_t tr = ((wr * real[j]) - (wi * imag[j])) >> 15;
+				int32_t ti = ((wr * imag[j]) + (wi * real[j])) >> 15;
+				
+				real[j] = (real[i] - tr) >> 1;
+				imag[j] = (imag[i] - ti) >> 1;
+				real[i] = (real[i] + tr) >> 1;
+				imag[i] = (imag[i] + ti) >> 1;
+			}
+		}
+	}
+}
+
+int resampleUniform(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int startIndex, uint32_t stepUs,
+                    int8_t *values, int count) {
+	if (startIndex < 0 || startIndex >= rec->sampleEnd) {
+		return 0;
+	}
+	
+	// times are from the start of startIndex, and the recording ends at the start of its last sample
+	int64_t endUs = 0;
+	for (int i = startIndex + 1; i < rec->sampleEnd; i++) {
+		endUs += rec->samples[i].timeDiffUs;
+	}
+	
+	int index = startIndex;
+	int64_t nextUs = (index + 1 < rec->sampleEnd) ? rec->samples[index + 1].timeDiffUs : INT64_MAX;
+	for (int i = 0; i < count; i++) {
+		int64_t timeUs = (int64_t) i * stepUs;
+		if (timeUs > endUs) {
+			return i;
+		}
+		while (nextUs <= timeUs) {
+			index++;
+			nextUs = (index + 1 < rec->sampleEnd) ? nextUs + rec->samples[index + 1].timeDiffUs : INT64_MAX;
+		}
+		values[i] = getControllerSampleAxisValue(rec->samples[index], axis);
+	}
+	return count;
+}
+
+// integer square root, rounded down
+static uint32_t sqrtFixed(uint32_t value) {
+	uint32_t root = 0;
+	uint32_t bit = 1u << 30;
+	while (bit > value) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+void analyzeSpectrum(const ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis, int startIndex,
+                     SpectrumResult *result) {
+	initSpectrumTables();
+	
+	result->peakBin = 0;
+	result->startIndex = startIndex;
+	result->windowSamples = resampleUniform(rec, axis, startIndex, SPECTRUM_SAMPLE_US, windowValues,
+	                                        SPECTRUM_SIZE);
+	int count = result->windowSamples;
+	
+	// the stick's resting position isn't what we're looking for, and it would hide everything near 0 Hz
+	int32_t sum = 0;
+	for (int i = 0; i < count; i++) {
+		sum += windowValues[i];
+	}
+	int32_t mean = (count == 0) ? 0 : ((sum >= 0) ? sum + (count / 2) : sum - (count / 2)) / count;
+	
+	// the window is stretched over whatever came from the recording, and the rest is zero
+	for (int i = 0; i < SPECTRUM_SIZE; i++) {
+		fftReal[i] = 0;
+		fftImag[i] = 0;
+		if (i < count && count > 1) {
+			int32_t value = (windowValues[i] - mean) * 64;
+			fftReal[i] = (value * hannWindow[(i * (SPECTRUM_SIZE - 1)) / (count - 1)]) >> 15;
+		}
+	}
+	
+	fftFixed(fftReal, fftImag);
+	
+	// the input is real, so the second half is a mirror of the first
+	uint16_t peak = 0;
+	for (int i = 0; i < SPECTRUM_BINS; i++) {
+		uint32_t power = ((int32_t) fftReal[i] * fftReal[i]) + ((int32_t) fftImag[i] * fftImag[i]);
+		result->magnitude[i] = sqrtFixed(power);
+		if (i != 0 && result->magnitude[i] > peak) {
+			peak = result->magnitude[i];
+			result->peakBin = i;
+		}
+	}
+}
@@ -0,0 +1,584 @@
+//
+// Created on 10/19/26.
+//
+
+#include "stickmap.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// these used to be arrays in coordinateviewer.c
+// the shield drop coordinates are from the SmashBoards UCF post
+static const char *BUILTIN_STICKMAPS =
+		"stickmap Firefox/Wavedash\n"
+		"desc Min/Max coordinates for Firefox and Wavedash notches around\n"
+		"desc cardinals\n"
+		"desc\n"
+		"desc SAFE / Green:\n"
+		"desc  Ideal coordinates, aim here\n"
+		"desc UNSAFE / Yellow:\n"
+		"desc  Risks hitting deadzone, but works\n"
+		"desc MISS:\n"
+		"desc  Self explanatory\n"
+		// these work on either side of any cardinal
+		"region 00FF00 000000 SAFE\n"
+		"mirror x y swap\n"
+		"point 9375 3125\n"
+		"point 9375 3250\n"
+		"region FFFF00 000000 UNSAFE\n"
+		"mirror x y swap\n"
+		"point 9500 3000\n"
+		"point 9500 2875\n"
+
+		"stickmap Shield Drop\n"
+		"desc Coordinates for Vanilla and UCF Shield drops. Different coordinate groups vary in "
+		"requirements, check the SmashBoards UCF post for more info.\n"
+		"desc\n"
+		"desc VANILLA / Green:\n"
+		"desc  Coordinates that will work without UCF\n"
+		"desc UCF LOWER / Blue:\n"
+		"desc  Lower coordinates for any UCF Version\n"
+		"desc UCF v0.84 UPPER / Yellow:\n"
+		"desc  Upper coordinates for v0.84+ only\n"
+		// vanilla only cares about y, these go to the edge of what the stick can reach
+		"region 00FF00 000000 VANILLA\n"
+		"rect -7375 -6625 7375 -6625\n"
+		"rect -7375 -6750 7375 -6750\n"
+		"rect -7250 -6875 7250 -6875\n"
+		"region 0000FF FFFFFF UCF LOWER\n"
+		"mirror x\n"
+		"point 7000 -7000\n"
+		"point 7125 -7000\n"
+		"point 6875 -7125\n"
+		"point 7000 -7125\n"
+		"point 6750 -7250\n"
+		"point 6875 -7250\n"
+		"point 6500 -7375\n"
+		"point 6625 -7375\n"
+		"point 6750 -7375\n"
+		"point 6375 -7500\n"
+		"point 6500 -7500\n"
+		"point 6250 -7625\n"
+		"point 6375 -7625\n"
+		"point 6125 -7750\n"
+		"point 6250 -7750\n"
+		"point 6000 -7875\n"
+		"point 6125 -7875\n"
+		"region FFFF00 000000 UCF v0.84 UPPER\n"
+		"mirror x\n"
+		"point 7875 -6125\n"
+		"point 7750 -6125\n"
+		"point 7625 -6250\n"
+		"point 7750 -6250\n"
+		"point 7500 -6375\n"
+		"point 7625 -6375\n"
+		"point 7375 -6500\n"
+		"point 7500 -6500\n";
+
+// longest line we'll read
+#define STICKMAP_LINE_LEN 256
+
+static Stickmap stickmaps[STICKMAP_MAX];
+static int stickmapCount = 0;
+static bool stickmapsReady = false;
+static uint32_t stickmapRevision = 0;
+
+// regions only take the quadrant bitmaps they have coordinates in
+// melee and raw units each have their own, since the bitmaps are different sizes
+static uint32_t quadrantBitmaps[STICKMAP_QUADRANT_MAX][STICKMAP_GRID_WORDS];
+static uint32_t rawQuadrantBitmaps[STICKMAP_RAW_QUADRANT_MAX][STICKMAP_RAW_GRID_WORDS];
+
+typedef struct QuadrantPool {
+	uint32_t *bitmaps;
+	int words;
+	int gridSize;
+	int max;
+	int count;
+} QuadrantPool;
+
+// indexed by enum STICKMAP_UNITS
+static QuadrantPool quadrantPools[2] = {
+	{ .bitmaps = &quadrantBitmaps[0][0], .words = STICKMAP_GRID_WORDS, .gridSize = STICKMAP_GRID_SIZE,
+	  .max = STICKMAP_QUADRANT_MAX },
+	{ .bitmaps = &rawQuadrantBitmaps[0][0], .words = STICKMAP_RAW_GRID_WORDS, .gridSize = STICKMAP_RAW_GRID_SIZE,
+	  .max = STICKMAP_RAW_QUADRANT_MAX },
+};
+
+// what the current line applies to
+typedef struct StickmapParser {
+	Stickmap *stickmap;
+	StickmapRegion *region;
+	bool mirrorX;
+	bool mirrorY;
+	bool mirrorSwap;
+} StickmapParser;
+
+// false if there aren't any quadrant bitmaps left
+static bool setStickmapCell(QuadrantPool *pool, StickmapRegion *region, int x, int y) {
+	int cell = (abs(x) * pool->gridSize) + abs(y);
+	uint32_t mask = 1u << (cell & 31);
+	// a cell on an axis is in more than one quadrant, it's only counted in this one
+	int countedQuadrant = ((x < 0) ? STICKMAP_QUADRANT_X_NEGATIVE : 0) | ((y < 0) ? STICKMAP_QUADRANT_Y_NEGATIVE : 0);
+	
+	for (int quadrant = 0; quadrant < 4; quadrant++) {
+		// the cell is on the negative side, or on an axis, which both sides have
+		if (((quadrant & STICKMAP_QUADRANT_X_NEGATIVE) ? (x > 0) : (x < 0)) ||
+		    ((quadrant & STICKMAP_QUADRANT_Y_NEGATIVE) ? (y > 0) : (y < 0))) {
+			continue;
+		}
+		if (region->quadrants[quadrant] == -1) {
+			if (pool->count == pool->max) {
+				return false;
+			}
+			memset(&pool->bitmaps[pool->count * pool->words], 0, pool->words * sizeof(uint32_t));
+			region->quadrants[quadrant] = pool->count;
+			pool->count++;
+		}
+		
+		uint32_t *bitmap = &pool->bitmaps[region->quadrants[quadrant] * pool->words];
+		if (!(bitmap[cell >> 5] & mask)) {
+			bitmap[cell >> 5] |= mask;
+			if (quadrant == countedQuadrant) {
+				region->cellCount++;
+			}
+		}
+	}
+	return true;
+}
+
+// adds every mirrored copy of the coordinate that the region asks for
+static bool addStickmapCell(StickmapParser *parser, int x, int y) {
+	for (int variant = 0; variant < 8; variant++) {
+		if (((variant & 0b001) && !parser->mirrorX) || ((variant & 0b010) && !parser->mirrorY) ||
+		    ((variant & 0b100) && !parser->mirrorSwap)) {
+			continue;
+		}
+		int cellX = (variant & 0b100) ? y : x;
+		int cellY = (variant & 0b100) ? x : y;
+		cellX = (variant & 0b001) ? -cellX : cellX;
+		cellY = (variant & 0b010) ? -cellY : cellY;
+		// raw -128 doesn't have a positive side to mirror to
+		if (parser->stickmap->units == STICKMAP_UNITS_RAW &&
+		    (cellX > STICKMAP_RAW_MAX - 1 || cellY > STICKMAP_RAW_MAX - 1)) {
+			continue;
+		}
+		if (!setStickmapCell(&quadrantPools[parser->stickmap->units], parser->region, cellX, cellY)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// reads one coordinate, and converts it to the stickmap's units
+static bool parseStickmapCoord(const Stickmap *stickmap, const char **str, int *units) {
+	char *end;
+	long value = strtol(*str, &end, 10);
+	if (end == *str) {
+		return false;
+	}
+	*str = end;
+	if (stickmap->units == STICKMAP_UNITS_RAW) {
+		*units = value;
+		return value >= -STICKMAP_RAW_MAX && value <= STICKMAP_RAW_MAX - 1;
+	}
+	*units = value / 125;
+	return value % 125 == 0 && labs(value) <= STICKMAP_UNIT_MAX * 125;
+}
+
+static bool isStickmapLineEnd(const char *str) {
+	while (isspace((unsigned char) *str)) {
+		str++;
+	}
+	return *str == '\0';
+}
+
+// reads count coordinates, and nothing else should be on the line
+static bool parseStickmapCoords(const Stickmap *stickmap, const char *str, int *units, int count) {
+	for (int i = 0; i < count; i++) {
+		if (!parseStickmapCoord(stickmap, &str, &units[i])) {
+			return false;
+		}
+	}
+	return isStickmapLineEnd(str);
+}
+
+static bool parseStickmapColor(const char *str, uint8_t *color) {
+	for (int i = 0; i < 6; i++) {
+		if (!isxdigit((unsigned char) str[i])) {
+			return false;
+		}
+	}
+	uint32_t value = strtoul(str, NULL, 16);
+	color[0] = (value >> 16) & 0xFF;
+	color[1] = (value >> 8) & 0xFF;
+	color[2] = value & 0xFF;
+	return true;
+}
+
+static bool parseStickmapLine(StickmapParser *parser, char *line) {
+	// comments and trailing whitespace don't matter
+	char *comment = strchr(line, '#');
+	if (comment != NULL) {
+		*comment = '\0';
+	}
+	int len = strlen(line);
+	while (len > 0 && isspace((unsigned char) line[len - 1])) {
+		line[--len] = '\0';
+	}
+	while (isspace((unsigned char) *line)) {
+		line++;
+	}
+	if (*line == '\0') {
+		return true;
+	}
+	
+	// the rest of the line starts after a single space, so that descriptions can be indented
+	char *rest = line;
+	while (*rest != '\0' && !isspace((unsigned char) *rest)) {
+		rest++;
+	}
+	if (*rest != '\0') {
+		*rest = '\0';
+		rest++;
+	}
+	
+	if (strcmp(line, "stickmap") == 0) {
+		if (stickmapCount == STICKMAP_MAX || *rest == '\0') {
+			return false;
+		}
+		Stickmap *stickmap = &stickmaps[stickmapCount];
+		stickmapCount++;
+		memset(stickmap, 0, sizeof(Stickmap));
+		strncpy(stickmap->name, rest, STICKMAP_NAME_LEN - 1);
+		
+		stickmap->units = STICKMAP_UNITS_MELEE;
+		stickmapRevision++;
+		stickmap->revision = stickmapRevision;
+		
+		// black background and white text, same as normal text
+		stickmap->regionCount = 1;
+		strcpy(stickmap->regions[0].name, "MISS");
+		memset(stickmap->regions[0].textColor, 0xFF, 3);
+		memset(stickmap->regions[0].quadrants, -1, sizeof(stickmap->regions[0].quadrants));
+		
+		parser->stickmap = stickmap;
+		parser->region = NULL;
+		return true;
+	}
+	if (parser->stickmap == NULL) {
+		return false;
+	}
+	
+	if (strcmp(line, "desc") == 0) {
+		int descLen = strlen(parser->stickmap->desc);
+		if (descLen + strlen(rest) + 1 >= STICKMAP_DESC_LEN) {
+			return false;
+		}
+		strcat(parser->stickmap->desc, rest);
+		strcat(parser->stickmap->desc, "\n");
+		return true;
+	}
+	
+	if (strcmp(line, "units") == 0) {
+		// the bitmaps depend on the units, so they can't change once there are regions
+		if (parser->stickmap->regionCount > 1) {
+			return false;
+		}
+		if (strcmp(rest, "melee") == 0) {
+			parser->stickmap->units = STICKMAP_UNITS_MELEE;
+		} else if (strcmp(rest, "raw") == 0) {
+			parser->stickmap->units = STICKMAP_UNITS_RAW;
+		} else {
+			return false;
+		}
+		return true;
+	}
+	
+	if (strcmp(line, "cstick") == 0) {
+		parser->stickmap->cStick = true;
+		return *rest == '\0';
+	}
+	
+	if (strcmp(line, "region") == 0) {
+		if (parser->stickmap->regionCount == STICKMAP_REGION_MAX) {
+			return false;
+		}
+		StickmapRegion *region = &parser->stickmap->regions[parser->stickmap->regionCount];
+		// colors are six characters each, with a space after them
+		if (strlen(rest) < 15 || !parseStickmapColor(rest, region->color) || rest[6] != ' ' ||
+		    !parseStickmapColor(rest + 7, region->textColor) || rest[13] != ' ') {
+			return false;
+		}
+		strncpy(region->name, rest + 14, STICKMAP_NAME_LEN - 1);
+		memset(region->quadrants, -1, sizeof(region->quadrants));
+		parser->stickmap->regionCount++;
+		
+		parser->region = region;
+		parser->mirrorX = false;
+		parser->mirrorY = false;
+		parser->mirrorSwap = false;
+		return true;
+	}
+	if (parser->region == NULL) {
+		return false;
+	}
+	
+	if (strcmp(line, "mirror") == 0) {
+		for (char *token = strtok(rest, " \t"); token != NULL; token = strtok(NULL, " \t")) {
+			if (strcmp(token, "x") == 0) {
+				parser->mirrorX = true;
+			} else if (strcmp(token, "y") == 0) {
+				parser->mirrorY = true;
+			} else if (strcmp(token, "swap") == 0) {
+				parser->mirrorSwap = true;
+			} else {
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	if (strcmp(line, "point") == 0) {
+		int units[2];
+		if (!parseStickmapCoords(parser->stickmap, rest, units, 2)) {
+			return false;
+		}
+		return addStickmapCell(parser, units[0], units[1]);
+	}
+	
+	if (strcmp(line, "rect") == 0) {
+		int units[4];
+		if (!parseStickmapCoords(parser->stickmap, rest, units, 4)) {
+			return false;
+		}
+		for (int x = (units[0] < units[2]) ? units[0] : units[2]; x <= ((units[0] < units[2]) ? units[2] : units[0]); x++) {
+			for (int y = (units[1] < units[3]) ? units[1] : units[3]; y <= ((units[1] < units[3]) ? units[3] : units[1]); y++) {
+				if (!addStickmapCell(parser, x, y)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+	
+	if (strcmp(line, "row") == 0) {
+		const char *str = rest;
+		int y, x1, x2;
+		if (!parseStickmapCoord(parser->stickmap, &str, &y)) {
+			return false;
+		}
+		// at least one pair
+		do {
+			if (!parseStickmapCoord(parser->stickmap, &str, &x1) ||
+			    !parseStickmapCoord(parser->stickmap, &str, &x2)) {
+				return false;
+			}
+			for (int x = (x1 < x2) ? x1 : x2; x <= ((x1 < x2) ? x2 : x1); x++) {
+				if (!addStickmapCell(parser, x, y)) {
+					return false;
+				}
+			}
+		} while (!isStickmapLineEnd(str));
+		return true;
+	}
+	
+	return false;
+}
+
+static void parseBuiltinStickmaps(const char *definitions) {
+	StickmapParser parser = { 0 };
+	char line[STICKMAP_LINE_LEN];
+	const char *lineStart = definitions;
+	while (*lineStart != '\0') {
+		const char *lineEnd = strchr(lineStart, '\n');
+		int len = (lineEnd == NULL) ? (int) strlen(lineStart) : lineEnd - lineStart;
+		if (len >= STICKMAP_LINE_LEN) {
+			len = STICKMAP_LINE_LEN - 1;
+		}
+		memcpy(line, lineStart, len);
+		line[len] = '\0';
+		parseStickmapLine(&parser, line);
+		
+		if (lineEnd == NULL) {
+			break;
+		}
+		lineStart = lineEnd + 1;
+	}
+}
+
+void initStickmaps() {
+	if (stickmapsReady) {
+		return;
+	}
+	stickmapsReady = true;
+	
+	parseBuiltinStickmaps(BUILTIN_STICKMAPS);
+	parseBuiltinStickmaps(BUILTIN_PLOT2D_STICKMAPS);
+}
+
+int getStickmapCount(enum STICKMAP_UNITS units) {
+	initStickmaps();
+	int count = 0;
+	for (int i = 0; i < stickmapCount; i++) {
+		if (stickmaps[i].units == units) {
+			count++;
+		}
+	}
+	return count;
+}
+
+const Stickmap *getStickmap(enum STICKMAP_UNITS units, int index) {
+	initStickmaps();
+	for (int i = 0; i < stickmapCount; i++) {
+		if (stickmaps[i].units != units) {
+			continue;
+		}
+		if (index == 0) {
+			return &stickmaps[i];
+		}
+		index--;
+	}
+	return NULL;
+}
+
+const Stickmap *findStickmap(const char *name) {
+	initStickmaps();
+	for (int i = 0; i < stickmapCount; i++) {
+		if (strcmp(stickmaps[i].name, name) == 0) {
+			return &stickmaps[i];
+		}
+	}
+	return NULL;
+}
+
+// moves the quadrant bitmaps that are still used to the front, after a stickmap is replaced
+static void compactStickmapQuadrants(enum STICKMAP_UNITS units) {
+	QuadrantPool *pool = &quadrantPools[units];
+	int16_t moved[STICKMAP_RAW_QUADRANT_MAX];
+	memset(moved, -1, sizeof(moved));
+	for (int i = 0; i < stickmapCount; i++) {
+		if (stickmaps[i].units != units) {
+			continue;
+		}
+		for (int region = 0; region < stickmaps[i].regionCount; region++) {
+			for (int quadrant = 0; quadrant < 4; quadrant++) {
+				if (stickmaps[i].regions[region].quadrants[quadrant] != -1) {
+					moved[stickmaps[i].regions[region].quadrants[quadrant]] = 0;
+				}
+			}
+		}
+	}
+	
+	// only ever moves toward the front, so nothing that's still used is overwritten
+	int used = 0;
+	for (int i = 0; i < pool->count; i++) {
+		if (moved[i] == -1) {
+			continue;
+		}
+		if (used != i) {
+			memcpy(&pool->bitmaps[used * pool->words], &pool->bitmaps[i * pool->words],
+			       pool->words * sizeof(uint32_t));
+		}
+		moved[i] = used;
+		used++;
+	}
+	pool->count = used;
+	
+	for (int i = 0; i < stickmapCount; i++) {
+		if (stickmaps[i].units != units) {
+			continue;
+		}
+		for (int region = 0; region < stickmaps[i].regionCount; region++) {
+			for (int quadrant = 0; quadrant < 4; quadrant++) {
+				int16_t *index = &stickmaps[i].regions[region].quadrants[quadrant];
+				if (*index != -1) {
+					*index = moved[*index];
+				}
+			}
+		}
+	}
+}
+
+int loadStickmapDefinitions(FILE *file) {
+	initStickmaps();
+	int firstNew = stickmapCount;
+	int firstNewQuadrant = quadrantPools[STICKMAP_UNITS_MELEE].count;
+	int firstNewRawQuadrant = quadrantPools[STICKMAP_UNITS_RAW].count;
+	
+	StickmapParser parser = { 0 };
+	char line[STICKMAP_LINE_LEN];
+	int lineNumber = 0;
+	while (fgets(line, STICKMAP_LINE_LEN, file) != NULL) {
+		lineNumber++;
+		if (!parseStickmapLine(&parser, line)) {
+			stickmapCount = firstNew;
+			quadrantPools[STICKMAP_UNITS_MELEE].count = firstNewQuadrant;
+			quadrantPools[STICKMAP_UNITS_RAW].count = firstNewRawQuadrant;
+			return lineNumber;
+		}
+	}
+	
+	// anything with the same name as one we already have replaces it, the rest are added on
+	bool replacedAny = false;
+	int kept = firstNew;
+	for (int i = firstNew; i < stickmapCount; i++) {
+		int replaced = -1;
+		for (int j = 0; j < firstNew; j++) {
+			if (strcmp(stickmaps[i].name, stickmaps[j].name) == 0) {
+				replaced = j;
+				break;
+			}
+		}
+		if (replaced != -1) {
+			memcpy(&stickmaps[replaced], &stickmaps[i], sizeof(Stickmap));
+			replacedAny = true;
+		} else {
+			if (kept != i) {
+				memcpy(&stickmaps[kept], &stickmaps[i], sizeof(Stickmap));
+			}
+			kept++;
+		}
+	}
+	stickmapCount = kept;
+	if (replacedAny) {
+		compactStickmapQuadrants(STICKMAP_UNITS_MELEE);
+		compactStickmapQuadrants(STICKMAP_UNITS_RAW);
+	}
+	return 0;
+}
+
+const uint32_t *getStickmapQuadrant(const Stickmap *stickmap, const StickmapRegion *region, int quadrant) {
+	const QuadrantPool *pool = &quadrantPools[stickmap->units];
+	return (region->quadrants[quadrant] == -1) ? NULL : &pool->bitmaps[region->quadrants[quadrant] * pool->words];
+}
+
+static int getRegionIndexAtCell(const Stickmap *stickmap, int quadrant, int cell) {
+	// later regions win if more than one has the coordinate
+	for (int i = stickmap->regionCount - 1; i > 0; i--) {
+		const uint32_t *bitmap = getStickmapQuadrant(stickmap, &stickmap->regions[i], quadrant);
+		if (bitmap != NULL && (bitmap[cell >> 5] & (1u << (cell & 31)))) {
+			return i;
+		}
+	}
+	return 0;
+}
+
+int getStickmapRegionIndex(const Stickmap *stickmap, MeleeCoordinates coords) {
+	if (stickmap->units != STICKMAP_UNITS_MELEE) {
+		return 0;
+	}
+	int cell = ((coords.stickXUnit / 125) * STICKMAP_GRID_SIZE) + (coords.stickYUnit / 125);
+	int quadrant = (coords.stickXNegative ? STICKMAP_QUADRANT_X_NEGATIVE : 0) |
+	               (coords.stickYNegative ? STICKMAP_QUADRANT_Y_NEGATIVE : 0);
+	return getRegionIndexAtCell(stickmap, quadrant, cell);
+}
+
+int getStickmapRawRegionIndex(const Stickmap *stickmap, int x, int y) {
+	if (stickmap->units != STICKMAP_UNITS_RAW) {
+		return 0;
+	}
+	int cell = (abs(x) * STICKMAP_RAW_GRID_SIZE) + abs(y);
+	int quadrant = ((x < 0) ? STICKMAP_QUADRANT_X_NEGATIVE : 0) | ((y < 0) ? STICKMAP_QUADRANT_Y_NEGATIVE : 0);
+	return getRegionIndexAtCell(stickmap, quadrant, cell);
+}
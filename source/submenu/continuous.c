@@ -10,11 +10,16 @@
 
 #include <ogc/pad.h>
 #include <ogc/timesupp.h>
+#include <ogc/irq.h>
 
 #include "util/print.h"
 #include "util/polling.h"
 #include "util/gx.h"
 #include "waveform.h"
+#include "analysis.h"
+#include "inputevents.h"
+#include "stickmap.h"
+#include "util/file.h"
 
 static enum CONT_MENU_STATE state = CONT_SETUP;
 static enum CONT_STATE cState = INPUT;
@@ -29,7 +34,22 @@ static uint16_t *held = NULL;
 
 static uint64_t prevSampleCallbackTick = 0;
 static uint64_t sampleCallbackTick = 0;
-static uint64_t frameCounter = 0;
+// decides which polls the game would read, see initFrameResampler()
+static FrameResampler resampler;
+static bool showGameReads = false;
+
+// melee inputs picked out of the polls the game reads, as they come in
+// this is fed from the sampling callback, so everything else reads eventSnapshot instead, see snapshotInputEvents()
+static InputEventDetector eventDetector;
+static InputEventDetector eventSnapshot;
+// every sample since setup(), a sample is at (sampleNumber % REC_SAMPLE_MAX) in the ring buffer
+static uint32_t sampleNumber = 0;
+static uint32_t snapshotSampleNumber = 0;
+static GraphMarker eventMarkers[INPUT_EVENT_MAX];
+static int exportReturnCode = -1;
+
+static const GXColor EVENT_COLORS[EVENT_TYPE_LEN] = { GX_COLOR_GREEN, GX_COLOR_YELLOW, GX_COLOR_ORANGE,
+                                                      GX_COLOR_SILVER, GX_COLOR_WHITE };
 
 static sampling_callback cb;
 
@@ -48,15 +68,20 @@ static void contSamplingCallback() {
 		data->samples[dataIndex].stickY = PAD_StickY(0);
 		data->samples[dataIndex].cStickX = PAD_SubStickX(0);
 		data->samples[dataIndex].cStickY = PAD_SubStickY(0);
-		frameCounter += ticks_to_microsecs(sampleCallbackTick - prevSampleCallbackTick);
-		// abusing timeDiffUs here, 1 means this poll is considered a frame interval, 0 otherwise
-		if (frameCounter >= FRAME_TIME_US) {
-			data->samples[dataIndex].timeDiffUs = 1;
-			frameCounter = 0;
-		} else {
-			data->samples[dataIndex].timeDiffUs = 0;
+		// only the detector uses these, the graph just has the sticks
+		data->samples[dataIndex].triggerL = PAD_TriggerL(0);
+		data->samples[dataIndex].triggerR = PAD_TriggerR(0);
+		data->samples[dataIndex].buttons = PAD_ButtonsHeld(0);
+		// abusing timeDiffUs here, 1 means the game would read this poll, 0 otherwise
+		// the game reads whatever poll is current, so we only know that a poll was read once the next one comes in
+		data->samples[dataIndex].timeDiffUs = 0;
+		if (feedFrameResampler(&resampler, ticks_to_microsecs(sampleCallbackTick - prevSampleCallbackTick)) != 0) {
+			int readIndex = (dataIndex + REC_SAMPLE_MAX - 1) % REC_SAMPLE_MAX;
+			data->samples[readIndex].timeDiffUs = 1;
+			feedInputEventDetector(&eventDetector, &data->samples[readIndex], sampleNumber - 1);
 		}
 		dataIndex++;
+		sampleNumber++;
 		if (dataIndex == REC_SAMPLE_MAX) {
 			dataIndex = 0;
 		}
@@ -66,6 +91,15 @@ static void contSamplingCallback() {
 	}
 }
 
+// copy the detector and sample count with interrupts off, so the callback can't add an event partway through
+static void snapshotInputEvents() {
+	uint32_t level;
+	_CPU_ISR_Disable(level);
+	eventSnapshot = eventDetector;
+	snapshotSampleNumber = sampleNumber;
+	_CPU_ISR_Restore(level);
+}
+
 static void displayInstructions() {
 	
 	setCursorPos(2, 0);
@@ -88,7 +122,23 @@ static void displayInstructions() {
 	drawFontButton(FONT_STICK_C);
 	printStr(".\n\n");
 	
-	printStr("The number of visible samples is shown above the recording window.");
+	printStr("The number of visible samples is shown above the recording window.\n\n");
+	
+	printStr("Press");
+	fontButtonSetDpadDirections(FONT_DPAD_UP);
+	drawFontButton(FONT_DPAD);
+	printStr("to show what Melee would read each frame over the waveform.");
+	
+	printStr("\n\nDashes, dashbacks, pivots, shield drops and wavedashes are marked under the waveform, "
+	         "from what Melee would read: ");
+	for (int i = 0; i < EVENT_TYPE_LEN; i++) {
+		printStrColor(EVENT_COLORS[i], GX_COLOR_BLACK, "%s", getInputEventName(i));
+		printStr((i + 1 < EVENT_TYPE_LEN) ? " " : ".");
+	}
+	printStr(" Shield drops use the Shield Drop stickmap from the coordinate viewer.\n\n"
+	         "While locked, press X");
+	drawFontButton(FONT_X);
+	printStr("to export the latest events to the SD card.");
 	
 	setWordWrap(false);
 	
@@ -116,6 +166,12 @@ static void setup() {
 		data->recordingType = REC_OSCILLOSCOPE_CONTINUOUS;
 		data->sampleEnd = 0;
 	}
+	initFrameResampler(&resampler, 0);
+	// the detector converts to melee units in the sampling callback, so the conversion table is built out here
+	convertStickRawToMelee((ControllerSample) { 0 });
+	initInputEventDetector(&eventDetector, findStickmap("Shield Drop"));
+	sampleNumber = dataIndex;
+	exportReturnCode = -1;
 	setSamplingRateHigh();
 	cb = PAD_SetSamplingCallback(contSamplingCallback);
 	state = CONT_POST_SETUP;
@@ -138,6 +194,8 @@ void menu_continuousWaveform() {
 			}
 			
 			if (cState == INPUT_LOCK) {
+				// nothing changes until the lock is released
+				menu_setFrameStatic();
 				setCursorPos(2, 25);
 				printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "LOCKED");
 				setCursorPos(2, 35);
@@ -173,6 +231,7 @@ void menu_continuousWaveform() {
 				drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y, SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y, GX_COLOR_GRAY);
 				
 				setDrawGraphStickAxis(selectedAxis);
+				setDrawGraphGameReads(showGameReads, 0);
 				
 				setCursorPos(1, 38);
 				printStr("Toggle Lock (A");
@@ -186,6 +245,19 @@ void menu_continuousWaveform() {
 					printStr(")");
 				}
 				
+				// events that are still in the ring buffer get a tick under the graph
+				snapshotInputEvents();
+				int markerCount = 0;
+				for (int i = 0; i < getInputEventBufferedCount(&eventSnapshot); i++) {
+					const InputEvent *event = getInputEvent(&eventSnapshot, i);
+					if (snapshotSampleNumber - event->sampleNumber < REC_SAMPLE_MAX) {
+						eventMarkers[markerCount].dataIndex = event->sampleNumber % REC_SAMPLE_MAX;
+						eventMarkers[markerCount].color = EVENT_COLORS[event->type];
+						markerCount++;
+					}
+				}
+				setDrawGraphMarkers(eventMarkers, markerCount);
+				
 				// equivalent to dataIndex + 3000 - 1
 				// +3000 because index needs to be positive for modulus to work properly,
 				// minus 1 because dataIndex is the _next_ index to be written to
@@ -196,7 +268,56 @@ void menu_continuousWaveform() {
 				int dataScrollOffset = 0, visibleDatapoints = 0;
 				getGraphDisplayedInfo(&dataScrollOffset, &visibleDatapoints);
 				
-				setCursorPos(21,0);
+				setCursorPos(21, 0);
+				printStr("Game Frames (");
+				fontButtonSetDpadDirections(FONT_DPAD_UP);
+				drawFontButton(FONT_DPAD);
+				printStr("): %s", showGameReads ? "On" : "Off");
+				
+				// newest event, and anything that tells it apart from a plain one
+				if (eventSnapshot.eventCount != 0) {
+					InputEvent event = *getInputEvent(&eventSnapshot, getInputEventBufferedCount(&eventSnapshot) - 1);
+					setCursorPos(20, 0);
+					printStr("Last Event: ");
+					printStrColor(EVENT_COLORS[event.type], GX_COLOR_BLACK, "%s", getInputEventName(event.type));
+					if (event.direction != 0) {
+						printStr(" %s", (event.direction < 0) ? "Left" : "Right");
+					}
+					switch (event.type) {
+						case EVENT_DASHBACK:
+						case EVENT_PIVOT:
+							if (event.detail != 0) {
+								printStr(", %u Slow-Turn Frame%s", event.detail, (event.detail == 1) ? "" : "s");
+							}
+							break;
+						case EVENT_SHIELD_DROP:
+							printStr(", %s", eventSnapshot.shieldDropMap->regions[event.detail].name);
+							break;
+						case EVENT_WAVEDASH:
+							printStr(", %.2f Degrees", getInputEventAngle(&event));
+							break;
+						default:
+							break;
+					}
+				}
+				
+				if (cState == INPUT_LOCK) {
+					setCursorPos(21, 36);
+					switch (exportReturnCode) {
+						case -1:
+							printStr("Export Events (X");
+							drawFontButton(FONT_X);
+							printStr(")");
+							break;
+						case 0:
+							printStr("Events Exported");
+							break;
+						default:
+							printStr("Export Failed (%d)", exportReturnCode);
+							break;
+					}
+				}
+				
 				if (cState == INPUT_LOCK) {
 					setCursorPos(3, 16);
 					printStr("%4u Samples, (%4u/%4u)", visibleDatapoints, dataScrollOffset,
@@ -208,8 +329,11 @@ void menu_continuousWaveform() {
 				if (*pressed & PAD_BUTTON_A) {
 					if (cState == INPUT_LOCK) {
 						cState = INPUT;
+						exportReturnCode = -1;
 					} else {
 						cState = INPUT_LOCK;
+						// the ring buffer is static from here on
+						markRecordingUpdated(data);
 					}
 				} else if (*pressed & PAD_BUTTON_Y) {
 					if (selectedAxis == AXIS_AXY) {
@@ -217,6 +341,10 @@ void menu_continuousWaveform() {
 					} else {
 						selectedAxis = AXIS_AXY;
 					}
+				} else if (*pressed & PAD_BUTTON_UP) {
+					showGameReads = !showGameReads;
+				} else if (*pressed & PAD_BUTTON_X && cState == INPUT_LOCK) {
+					exportReturnCode = exportInputEvents(&eventSnapshot);
 				}
 			}
 			
@@ -226,6 +354,7 @@ void menu_continuousWaveform() {
 			break;
 		case CONT_INSTRUCTIONS:
 			displayInstructions();
+			menu_setFrameStatic();
 			break;
 	}
 }
@@ -67,6 +67,59 @@ static void setup() {
 	menuState = CONT_TEST_POST_SETUP;
 }
 
+// stick lines and caps are drawn last, with the newest controller values, see setLateLatchDraw()
+static void drawStickCaps(const PADStatus *status) {
+	changeLoadedTexmap(TEXMAP_CONTROLLER);
+	
+	// figure out where stick should go to
+	int stickModX = status->stickX / 2;
+	int stickModY = status->stickY / 2;
+	
+	setLineWidth(40);
+	
+	// actually draw the line
+	drawLine(LAYOUT_ASTICK_GATE_POS_X + (TEX_ASTICK_GATE_DIMS / 2),
+	         LAYOUT_ASTICK_GATE_POS_Y + (TEX_ASTICK_GATE_DIMS / 2),
+	         LAYOUT_ASTICK_GATE_POS_X + (TEX_ASTICK_GATE_DIMS / 2) + stickModX,
+	         LAYOUT_ASTICK_GATE_POS_Y + (TEX_ASTICK_GATE_DIMS / 2) - stickModY,
+			 GX_COLOR_WHITE);
+	
+	setLineWidth(12);
+	
+	// stick cap
+	drawSubTexture(LAYOUT_ASTICK_CAP_POS_X + stickModX, LAYOUT_ASTICK_CAP_POS_Y - stickModY,
+	               LAYOUT_ASTICK_CAP_POS_X + TEX_STICK_DIMS + stickModX,
+	               LAYOUT_ASTICK_CAP_POS_Y + TEX_STICK_DIMS - stickModY,
+	               TEX_ASTICK_CAP_OFFSET_X, TEX_ASTICK_CAP_OFFSET_Y,
+	               TEX_ASTICK_CAP_OFFSET_X + TEX_STICK_DIMS,
+	               TEX_ASTICK_CAP_OFFSET_Y + TEX_STICK_DIMS,
+				   GX_COLOR_WHITE);
+	
+	// figure out where stick should go to
+	int cStickModX = status->substickX / 2;
+	int cStickModY = status->substickY / 2;
+	
+	setLineWidth(40);
+	
+	// actually draw the line
+	drawLine(LAYOUT_CSTICK_POS_X + (TEX_STICK_DIMS / 2),
+	         LAYOUT_CSTICK_POS_Y + (TEX_STICK_DIMS / 2),
+	         LAYOUT_CSTICK_POS_X + (TEX_STICK_DIMS / 2) + cStickModX,
+	         LAYOUT_CSTICK_POS_Y + (TEX_STICK_DIMS / 2) - cStickModY,
+			 GX_COLOR_YELLOW);
+	
+	setLineWidth(12);
+	
+	// c-stick cap
+	drawSubTexture(LAYOUT_CSTICK_POS_X + cStickModX, LAYOUT_CSTICK_POS_Y - cStickModY - 1,
+	               LAYOUT_CSTICK_POS_X + TEX_STICK_DIMS + cStickModX,
+	               LAYOUT_CSTICK_POS_Y + TEX_STICK_DIMS - cStickModY - 1,
+	               TEX_CSTICK_CAP_OFFSET_X, TEX_CSTICK_CAP_OFFSET_Y,
+	               TEX_CSTICK_CAP_OFFSET_X + TEX_STICK_DIMS,
+	               TEX_CSTICK_CAP_OFFSET_Y + TEX_STICK_DIMS,
+				   GX_COLOR_YELLOW);
+}
+
 // controller test submenu
 // basic visual button and stick test
 // also shows coordinates (raw and melee converted), and origin values
@@ -197,12 +250,12 @@ void menu_controllerTest() {
 			// L
 			int sliderBottomY = LAYOUT_ANALOG_SLIDER_POS_Y + 255;
 			int sliderTopY = sliderBottomY - PAD_TriggerL(0);
-			GX_SetLineWidth(24, GX_TO_ZERO);
+			setLineWidth(24);
 			
 			GXColor sliderColor = GX_COLOR_RED;
 			if (*held & PAD_TRIGGER_L) {
 				sliderColor = GX_COLOR_BLUE;
-				GX_SetLineWidth(32, GX_TO_ZERO);
+				setLineWidth(32);
 			}
 			
 			drawSolidBox(LAYOUT_ANALOG_SLIDER_POS_X, LAYOUT_ANALOG_SLIDER_POS_Y,
@@ -214,7 +267,7 @@ void menu_controllerTest() {
 			drawBox(LAYOUT_ANALOG_SLIDER_POS_X, LAYOUT_ANALOG_SLIDER_POS_Y,
 			        LAYOUT_ANALOG_SLIDER_POS_X + 16, sliderBottomY, GX_COLOR_WHITE);
 		
-			GX_SetLineWidth(24, GX_TO_ZERO);
+			setLineWidth(24);
 			
 			// R
 			sliderTopY = sliderBottomY - PAD_TriggerR(0);
@@ -222,7 +275,7 @@ void menu_controllerTest() {
 			sliderColor = GX_COLOR_RED;
 			if (*held & PAD_TRIGGER_R) {
 				sliderColor = GX_COLOR_BLUE;
-				GX_SetLineWidth(32, GX_TO_ZERO);
+				setLineWidth(32);
 			}
 			
 			drawSolidBox(640 - 16 - LAYOUT_ANALOG_SLIDER_POS_X, LAYOUT_ANALOG_SLIDER_POS_Y,
@@ -234,7 +287,7 @@ void menu_controllerTest() {
 			drawBox(640 - 16 - LAYOUT_ANALOG_SLIDER_POS_X, LAYOUT_ANALOG_SLIDER_POS_Y,
 			        640 - LAYOUT_ANALOG_SLIDER_POS_X, sliderBottomY, GX_COLOR_WHITE);
 			
-			GX_SetLineWidth(12, GX_TO_ZERO);
+			setLineWidth(12);
 			
 			changeLoadedTexmap(TEXMAP_CONTROLLER);
 			setDepth(-4);
@@ -354,30 +407,6 @@ void menu_controllerTest() {
 			               TEX_START_OFFSET_X + (TEX_START_DIMS * 2), TEX_START_OFFSET_Y + TEX_START_DIMS,
 			               GX_COLOR_WHITE);
 			
-			// figure out where stick should go to
-			int stickModX = PAD_StickX(0) / 2;
-			int stickModY = PAD_StickY(0) / 2;
-			
-			GX_SetLineWidth(40, GX_TO_ZERO);
-			
-			// actually draw the line
-			drawLine(LAYOUT_ASTICK_GATE_POS_X + (TEX_ASTICK_GATE_DIMS / 2),
-			         LAYOUT_ASTICK_GATE_POS_Y + (TEX_ASTICK_GATE_DIMS / 2),
-			         LAYOUT_ASTICK_GATE_POS_X + (TEX_ASTICK_GATE_DIMS / 2) + stickModX,
-			         LAYOUT_ASTICK_GATE_POS_Y + (TEX_ASTICK_GATE_DIMS / 2) - stickModY,
-					 GX_COLOR_WHITE);
-			
-			GX_SetLineWidth(12, GX_TO_ZERO);
-			
-			// stick cap
-			drawSubTexture(LAYOUT_ASTICK_CAP_POS_X + stickModX, LAYOUT_ASTICK_CAP_POS_Y - stickModY,
-			               LAYOUT_ASTICK_CAP_POS_X + TEX_STICK_DIMS + stickModX,
-			               LAYOUT_ASTICK_CAP_POS_Y + TEX_STICK_DIMS - stickModY,
-			               TEX_ASTICK_CAP_OFFSET_X, TEX_ASTICK_CAP_OFFSET_Y,
-			               TEX_ASTICK_CAP_OFFSET_X + TEX_STICK_DIMS,
-			               TEX_ASTICK_CAP_OFFSET_Y + TEX_STICK_DIMS,
-						   GX_COLOR_WHITE);
-			
 			// c-stick gate
 			drawSubTexture(LAYOUT_CSTICK_POS_X, LAYOUT_CSTICK_POS_Y,
 			               LAYOUT_CSTICK_POS_X + TEX_STICK_DIMS, LAYOUT_CSTICK_POS_Y + TEX_STICK_DIMS,
@@ -397,29 +426,8 @@ void menu_controllerTest() {
 			               TEX_START_OFFSET_X + (TEX_START_DIMS * 2), TEX_START_OFFSET_Y + TEX_START_DIMS,
 			               GX_COLOR_YELLOW);
 			
-			// figure out where stick should go to
-			int cStickModX = PAD_SubStickX(0) / 2;
-			int cStickModY = PAD_SubStickY(0) / 2;
-			
-			GX_SetLineWidth(40, GX_TO_ZERO);
-			
-			// actually draw the line
-			drawLine(LAYOUT_CSTICK_POS_X + (TEX_STICK_DIMS / 2),
-			         LAYOUT_CSTICK_POS_Y + (TEX_STICK_DIMS / 2),
-			         LAYOUT_CSTICK_POS_X + (TEX_STICK_DIMS / 2) + cStickModX,
-			         LAYOUT_CSTICK_POS_Y + (TEX_STICK_DIMS / 2) - cStickModY,
-					 GX_COLOR_YELLOW);
-			
-			GX_SetLineWidth(12, GX_TO_ZERO);
-			
-			// c-stick cap
-			drawSubTexture(LAYOUT_CSTICK_POS_X + cStickModX, LAYOUT_CSTICK_POS_Y - cStickModY - 1,
-			               LAYOUT_CSTICK_POS_X + TEX_STICK_DIMS + cStickModX,
-			               LAYOUT_CSTICK_POS_Y + TEX_STICK_DIMS - cStickModY - 1,
-			               TEX_CSTICK_CAP_OFFSET_X, TEX_CSTICK_CAP_OFFSET_Y,
-			               TEX_CSTICK_CAP_OFFSET_X + TEX_STICK_DIMS,
-			               TEX_CSTICK_CAP_OFFSET_Y + TEX_STICK_DIMS,
-						   GX_COLOR_YELLOW);
+			// stick lines and caps are drawn in drawStickCaps(), right before the frame goes out
+			setLateLatchDraw(drawStickCaps);
 			
 			restorePrevDepth();
 			
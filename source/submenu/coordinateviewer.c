@@ -13,170 +13,18 @@
 #include "waveform.h"
 #include "util/polling.h"
 #include "util/print.h"
+#include "util/file.h"
+#include "stickmap.h"
 
-enum STICKMAP_LIST { NONE, FF_WD, SHIELDDROP };
+// stickmap regions are defined in stickmap.c, and can be added to from /GTS/stickmaps.txt
 
-// values used for individual coordinate sets
-// since all of these are more than just individual values,
-// these are actually static consts, rather than #defines (like in controllertest.h)
-
-// Firefox and Wavedash min/max
-static const char* STICKMAP_FF_WD_DESC = "Min/Max coordinates for Firefox and Wavedash notches around\ncardinals\n\n"
-                                  "SAFE / Green:\n Ideal coordinates, aim here\n"
-								  "UNSAFE / Yellow:\n Risks hitting deadzone, but works\n"
-                                  "MISS:\n Self explanatory";
-
-static const char* STICKMAP_FF_WD_RETVALS[] = {"MISS", "SAFE", "UNSAFE"};
-
-// colors for the above responses, separated because it looks better this way
-// 0 -> no color
-// 1 -> black text on green background
-// 2 -> black text on yellow background
-static const GXColor STICKMAP_FF_WD_RETCOLORS[][2] = { {GX_COLOR_BLACK, GX_COLOR_WHITE},
-                                                {GX_COLOR_GREEN, GX_COLOR_BLACK},
-                                                {GX_COLOR_YELLOW, GX_COLOR_BLACK} };
-
-enum STICKMAP_FF_WD_ENUM { FF_WD_MISS, FF_WD_SAFE, FF_WD_UNSAFE };
-static const int STICKMAP_FF_WD_ENUM_LEN = 3;
-
-static const int STICKMAP_FF_WD_COORD_SAFE[][2] = { {9375, 3125},
-                                             {9375, 3250} };
-static const int STICKMAP_FF_WD_COORD_SAFE_LEN = 2;
-
-static const int STICKMAP_FF_WD_COORD_UNSAFE[][2] = { {9500, 3000},
-                                               {9500, 2875} };
-static const int STICKMAP_FF_WD_COORD_UNSAFE_LEN = 2;
-
-// Shield drop coordinates
-static const char* STICKMAP_SHIELDDROP_DESC = "Coorinates for Vanilla and UCF Shield drops. Different "
-                                       "coordinate groups vary in requirements, check the SmashBoards "
-                                       "UCF post for more info.\n\n"
-                                       "VANILLA / Green:\n Coordinates that will work without UCF\n"
-                                       "UCF LOWER / Blue:\n Lower coordinates for any UCF Version\n"
-                                       "UCF v0.84 UPPER / Yellow:\n Upper coordinates for v0.84+ only\n";
-
-static const char* STICKMAP_SHIELDDROP_RETVALS[] = { "MISS", "VANILLA", "UCF LOWER", "UCF v0.84 UPPER" };
-
-// 0 -> no color
-// 1 -> black text on green background
-// 2 -> white text on blue background
-// 3 -> black text on yellow background
-static const GXColor STICKMAP_SHIELDDROP_RETCOLORS[][2] = { {GX_COLOR_BLACK, GX_COLOR_WHITE},
-                                                     {GX_COLOR_GREEN, GX_COLOR_BLACK},
-                                                     {GX_COLOR_BLUE, GX_COLOR_WHITE},
-                                                     {GX_COLOR_YELLOW, GX_COLOR_BLACK} };
-
-enum STICKMAP_SHIELDDROP_ENUM { SHIELDDROP_MISS, SHIELDDROP_VANILLA, SHIELDDROP_UCF_LOWER, SHIELDDROP_UCF_UPPER };
-static const int STICKMAP_SHIELDDROP_ENUM_LEN = 4;
-
-static const int STICKMAP_SHIELDDROP_COORD_VANILLA[][2] = { { 7375, 6625 },
-                                                     { 7375, 6750 },
-                                                     { 7250, 6875 } };
-static const int STICKMAP_SHIELDDROP_COORD_VANILLA_LEN = 3;
-
-static const int STICKMAP_SHIELDDROP_COORD_UCF_LOWER[][2] = { { 7000, 7000 },
-                                                       { 7125, 7000 },
-                                                       
-                                                       { 6875, 7125 },
-                                                       { 7000, 7125 },
-                                                       
-                                                       { 6750, 7250 },
-                                                       { 6875, 7250 },
-                                                       
-                                                       { 6500, 7375 },
-                                                       { 6625, 7375 },
-                                                       { 6750, 7375 },
-                                                       
-                                                       { 6375, 7500 },
-                                                       { 6500, 7500 },
-                                                       
-                                                       { 6250, 7625 },
-                                                       { 6375, 7625 },
-                                                       
-                                                       { 6125, 7785 },
-                                                       { 6250, 7785 },
-                                                       { 6000, 7875 },
-                                                       { 6125, 7875 } };
-static const int STICKMAP_SHIELDDROP_COORD_UCF_LOWER_LEN = 17;
-
-static const int STICKMAP_SHIELDDROP_COORD_UCF_UPPER[][2] = { { 7875, 6125 },
-                                                       { 7750, 6125 },
-                                                       
-                                                       { 7625, 6250 },
-                                                       { 7750, 6250 },
-                                                       
-                                                       { 7500, 6375 },
-                                                       { 7625, 6375 },
-                                                       
-                                                       { 7375, 6500 },
-                                                       { 7500, 6500 } };
-static const int STICKMAP_SHIELDDROP_COORD_UCF_UPPER_LEN = 8;
-
-static int isCoordValid(enum STICKMAP_LIST test, MeleeCoordinates coords) {
-	// 0 index is always "show all"
-	int ret = 0;
-	switch (test) {
-		case FF_WD:
-			// safe coords
-			for (int i = 0; i < STICKMAP_FF_WD_COORD_SAFE_LEN; i++) {
-				if ((coords.stickXUnit == STICKMAP_FF_WD_COORD_SAFE[i][0] && coords.stickYUnit == STICKMAP_FF_WD_COORD_SAFE[i][1]) ||
-				    (coords.stickYUnit == STICKMAP_FF_WD_COORD_SAFE[i][0] && coords.stickXUnit == STICKMAP_FF_WD_COORD_SAFE[i][1])) {
-					ret = 1;
-					break;
-				}
-			}
-			// unsafe coords
-			for (int i = 0; i < STICKMAP_FF_WD_COORD_UNSAFE_LEN; i++) {
-				if ((coords.stickXUnit == STICKMAP_FF_WD_COORD_UNSAFE[i][0] && coords.stickYUnit == STICKMAP_FF_WD_COORD_UNSAFE[i][1]) ||
-				    (coords.stickYUnit == STICKMAP_FF_WD_COORD_UNSAFE[i][0] && coords.stickXUnit == STICKMAP_FF_WD_COORD_UNSAFE[i][1]) ) {
-					ret = 2;
-					break;
-				}
-			}
-			break;
-		case SHIELDDROP:
-			if (coords.stickYNegative) {
-				// vanilla
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_VANILLA_LEN; i++) {
-					if (coords.stickYUnit == STICKMAP_SHIELDDROP_COORD_VANILLA[i][1] ||
-					    (coords.stickYUnit * -1) == STICKMAP_SHIELDDROP_COORD_VANILLA[i][1]) {
-						ret = 1;
-						break;
-					}
-				}
-				// ucf lower
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_UCF_LOWER_LEN; i++) {
-					if ((coords.stickXUnit == STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][0] &&
-					     coords.stickYUnit == STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][1]) ||
-					    ((coords.stickXUnit * -1) == STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][0] &&
-					     coords.stickYUnit == STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][1])) {
-						ret = 2;
-						break;
-					}
-				}
-				// ucf v0.84 upper
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_UCF_UPPER_LEN; i++) {
-					if ((coords.stickXUnit == STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][0] &&
-					     coords.stickYUnit == STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][1]) ||
-					    ((coords.stickXUnit * -1) == STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][0] &&
-					     coords.stickYUnit == STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][1])) {
-						ret = 3;
-						break;
-					}
-				}
-			}
-		case (NONE):
-		default:
-			break;
-	}
-	return ret;
+// region colors are stored as rgb, so the stickmap module doesn't need ogc
+static GXColor toGXColor(const uint8_t *color) {
+	return (GXColor) { color[0], color[1], color[2], 0xFF };
 }
 
-// we're storing coordinates as whole integers of the decimal part
-// each visible unit is 0.0125, so we divide by 125 to get the number of units moved
-// then scaled by 2x for visibility
-static int toStickmap(int meleeCoord) {
-	return ((meleeCoord / 125) * 2);
+static void printStickmapRegion(const StickmapRegion *region) {
+	printStrColor(toGXColor(region->color), toGXColor(region->textColor), "%s", region->name);
 }
 
 static uint16_t *pressed = NULL;
@@ -184,9 +32,12 @@ static uint16_t *held = NULL;
 
 static enum COORD_VIEW_MENU_STATE menuState = COORD_VIEW_SETUP;
 
-static enum STICKMAP_LIST selectedStickmap = NONE;
-// will be casted to whichever stickmap is selected
+// 0 is none, otherwise the stickmap at (selectedStickmap - 1)
+static int selectedStickmap = 0;
+// 0 is all, otherwise the region of the selected stickmap
 static int selectedStickmapSub = 0;
+// result of importStickmaps()
+static int stickmapImportResult = -1;
 
 static bool menuLockEnabled = false;
 
@@ -196,179 +47,102 @@ static void setup() {
 		held = getButtonsHeldPtr();
 	}
 	
+	initStickmaps();
+	stickmapImportResult = importStickmaps();
+	
 	menuState = COORD_VIEW_POST_SETUP;
 	resetScrollingPrint();
 }
 
 
-// TODO: this is awful. find a better way to do this...
-static void drawStickmapOverlay(enum STICKMAP_LIST stickmap, int which) {
+static const Stickmap *getSelectedStickmap() {
+	return (selectedStickmap == 0) ? NULL : getStickmap(STICKMAP_UNITS_MELEE, selectedStickmap - 1);
+}
+
+// draws every coordinate in the region bitmaps, which is 0 for all of them
+static void drawStickmapOverlay(const Stickmap *stickmap, int which) {
+	if (stickmap == NULL) {
+		return;
+	}
 	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
 	changeLoadedTexmap(TEXMAP_NONE);
-	GX_SetPointSize(20, GX_TO_ZERO);
+	setPointSize(20);
 	
-	switch (stickmap) {
-		case (FF_WD):
-			// bools for which parts to draw
-			// this is dumb, but avoids duplicate code
-			bool drawSafe = true, drawUnsafe = true;
-			
-			switch ((enum STICKMAP_FF_WD_ENUM) which) {
-				case (FF_WD_SAFE):
-					drawUnsafe = false;
-					break;
-				case (FF_WD_UNSAFE):
-					drawSafe = false;
-					break;
-				// miss is interpreted as "all" in this case
-				case (FF_WD_MISS):
-				default:
-					break;
-			}
-			
-			if (drawSafe) {
-				GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, STICKMAP_FF_WD_COORD_SAFE_LEN * 8);
-				for (int i = 0; i < STICKMAP_FF_WD_COORD_SAFE_LEN; i++) {
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]) + COORD_CIRCLE_CENTER_X,
-					                toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]),
-					                toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]) + COORD_CIRCLE_CENTER_X,
-					                SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]), -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]),
-					                SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]), -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]) + COORD_CIRCLE_CENTER_X,
-					                toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]),
-					                toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]) + COORD_CIRCLE_CENTER_X,
-					                SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]), -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][1]),
-					                SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_SAFE[i][0]), -9);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-				}
-				GX_End();
-			}
-			if (drawUnsafe) {
-				GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, STICKMAP_FF_WD_COORD_UNSAFE_LEN * 8);
-				for (int i = 0; i < STICKMAP_FF_WD_COORD_UNSAFE_LEN; i++) {
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]) + COORD_CIRCLE_CENTER_X,
-					                    toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]),
-					                    toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]) + COORD_CIRCLE_CENTER_X,
-					                    SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]), -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]),
-					                    SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]), -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]) + COORD_CIRCLE_CENTER_X,
-					                    toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]),
-					                    toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]) + COORD_CIRCLE_CENTER_X,
-					                    SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]), -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][1]),
-					                    SCREEN_POS_CENTER_Y - toStickmap(STICKMAP_FF_WD_COORD_UNSAFE[i][0]), -8);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-				}
-				GX_End();
-			}
-			break;
-		case (SHIELDDROP):
-			// bools for which parts to draw
-			// this is dumb, but avoids duplicate code
-			bool drawVanilla = true, drawUCFUpper = true, drawUCFLower = true;
-			switch ((enum STICKMAP_SHIELDDROP_ENUM) which) {
-				case (SHIELDDROP_VANILLA):
-					drawUCFUpper = false;
-					drawUCFLower = false;
-					break;
-				case (SHIELDDROP_UCF_LOWER):
-					drawVanilla = false;
-					drawUCFUpper = false;
-					break;
-				case (SHIELDDROP_UCF_UPPER):
-					drawVanilla = false;
-					drawUCFLower = false;
-					break;
-				case (SHIELDDROP_MISS):
-				default:
-					break;
-			}
-			
-			if (drawUCFUpper) {
-				GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, STICKMAP_SHIELDDROP_COORD_UCF_UPPER_LEN * 2);
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_UCF_UPPER_LEN; i++) {
-					GX_Position3s16(toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][0]) + COORD_CIRCLE_CENTER_X,
-					                    toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][1]) + SCREEN_POS_CENTER_Y, -10);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][0]),
-					                    toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_UPPER[i][1]) + SCREEN_POS_CENTER_Y, -10);
-					GX_Color4u8(GX_COLOR_YELLOW.r, GX_COLOR_YELLOW.g, GX_COLOR_YELLOW.b, GX_COLOR_YELLOW.a);
-				}
-				GX_End();
-			}
-			if (drawUCFLower) {
-				GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, STICKMAP_SHIELDDROP_COORD_UCF_LOWER_LEN * 2);
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_UCF_LOWER_LEN; i++) {
-					GX_Position3s16(toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][0]) + COORD_CIRCLE_CENTER_X,
-					                    toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][1]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_BLUE.r, GX_COLOR_BLUE.g, GX_COLOR_BLUE.b, GX_COLOR_BLUE.a);
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][0]),
-					                    toStickmap(STICKMAP_SHIELDDROP_COORD_UCF_LOWER[i][1]) + SCREEN_POS_CENTER_Y, -9);
-					GX_Color4u8(GX_COLOR_BLUE.r, GX_COLOR_BLUE.g, GX_COLOR_BLUE.b, GX_COLOR_BLUE.a);
-				}
-				GX_End();
+	for (int i = 1; i < stickmap->regionCount; i++) {
+		const StickmapRegion *region = &stickmap->regions[i];
+		if ((which != 0 && which != i) || region->cellCount == 0) {
+			continue;
+		}
+		
+		// later regions are drawn on top, same as getStickmapRegionIndex()
+		beginPrimitive(GX_POINTS, VTXFMT_PRIMITIVES_INT, region->cellCount);
+		for (int quadrant = 0; quadrant < 4; quadrant++) {
+			const uint32_t *bitmap = getStickmapQuadrant(stickmap, region, quadrant);
+			if (bitmap == NULL) {
+				continue;
 			}
-			if (drawVanilla) {
-				GX_Begin(GX_LINES, VTXFMT_PRIMITIVES_INT, STICKMAP_SHIELDDROP_COORD_VANILLA_LEN * 2);
-				for (int i = 0; i < STICKMAP_SHIELDDROP_COORD_VANILLA_LEN; i++) {
-					
-					GX_Position3s16(COORD_CIRCLE_CENTER_X - toStickmap(STICKMAP_SHIELDDROP_COORD_VANILLA[i][0]) - 1,
-					          toStickmap(STICKMAP_SHIELDDROP_COORD_VANILLA[i][1]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
-					
-					GX_Position3s16(toStickmap(STICKMAP_SHIELDDROP_COORD_VANILLA[i][0]) + COORD_CIRCLE_CENTER_X + 1,
-					          toStickmap(STICKMAP_SHIELDDROP_COORD_VANILLA[i][1]) + SCREEN_POS_CENTER_Y, -8);
-					GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
+			for (int word = 0; word < STICKMAP_GRID_WORDS; word++) {
+				uint32_t bits = bitmap[word];
+				while (bits != 0) {
+					int cell = (word * 32) + __builtin_ctz(bits);
+					bits &= bits - 1;
+					// cells on an axis are in the positive quadrant too, and cellCount only has them once
+					if (((quadrant & STICKMAP_QUADRANT_X_NEGATIVE) && cell < STICKMAP_GRID_SIZE) ||
+					    ((quadrant & STICKMAP_QUADRANT_Y_NEGATIVE) && (cell % STICKMAP_GRID_SIZE) == 0)) {
+						continue;
+					}
+					GX_Position3s16(COORD_CIRCLE_CENTER_X + (STICKMAP_CELL_X(STICKMAP_GRID_SIZE, quadrant, cell) * 2),
+					                SCREEN_POS_CENTER_Y - (STICKMAP_CELL_Y(STICKMAP_GRID_SIZE, quadrant, cell) * 2),
+					                -10 + i);
+					GX_Color4u8(region->color[0], region->color[1], region->color[2], 0xFF);
 				}
-				GX_End();
 			}
-			break;
-		default:
-			break;
+		}
+		GX_End();
 	}
 }
 
+// stick and c-stick lines are drawn last, with the newest controller values, see setLateLatchDraw()
+static void drawStickCursors(const PADStatus *status) {
+	ControllerSample raw = { 0 };
+	raw.stickX = status->stickX, raw.stickY = status->stickY;
+	raw.cStickX = status->substickX, raw.cStickY = status->substickY;
+	MeleeCoordinates melee = convertStickRawToMelee(raw);
+	
+	// calculate screen coordinates for stick position drawing
+	int xfbCoordX = (melee.stickXUnit / 125) * 2;
+	if (raw.stickX < 0) {
+		xfbCoordX *= -1;
+	}
+	xfbCoordX += COORD_CIRCLE_CENTER_X;
+	
+	int xfbCoordY = (melee.stickYUnit / 125) * 2;
+	if (raw.stickY > 0) {
+		xfbCoordY *= -1;
+	}
+	xfbCoordY += SCREEN_POS_CENTER_Y;
+	
+	int xfbCoordCX = (melee.cStickXUnit / 125) * 2;
+	if (raw.cStickX < 0) {
+		xfbCoordCX *= -1;
+	}
+	xfbCoordCX += COORD_CIRCLE_CENTER_X;
+	
+	int xfbCoordCY = (melee.cStickYUnit / 125) * 2;
+	if (raw.cStickY > 0) {
+		xfbCoordCY *= -1;
+	}
+	xfbCoordCY += SCREEN_POS_CENTER_Y;
+	
+	// draw analog stick line
+	drawLine(COORD_CIRCLE_CENTER_X, SCREEN_POS_CENTER_Y, xfbCoordX, xfbCoordY, GX_COLOR_WHITE);
+	drawBox(xfbCoordX - 4, xfbCoordY - 4, xfbCoordX + 4, xfbCoordY + 4, GX_COLOR_WHITE);
+	
+	// draw c-stick line
+	drawLine(COORD_CIRCLE_CENTER_X, SCREEN_POS_CENTER_Y, xfbCoordCX, xfbCoordCY, GX_COLOR_YELLOW);
+	drawSolidBox(xfbCoordCX - 2, xfbCoordCY - 2, xfbCoordCX + 2, xfbCoordCY + 2, GX_COLOR_YELLOW);
+}
+
 static void displayInstructions() {
 	//setCursorPos(2, 0);
 	startScrollingPrint(40, 70, 600, 400);
@@ -398,19 +172,22 @@ static void displayInstructions() {
 	fontButtonSetDpadDirections(FONT_DPAD_LEFT | FONT_DPAD_RIGHT);
 	drawFontButton(FONT_DPAD);
 	printStr("): ");
-	switch (selectedStickmap) {
-		case FF_WD:
-			printStr("Firefox / Wavedash\n");
-			printStr(STICKMAP_FF_WD_DESC);
-			break;
-		case SHIELDDROP:
-			printStr("Shield Drop\n");
-			printStr(STICKMAP_SHIELDDROP_DESC);
-			break;
-		case NONE:
-		default:
-			printStr("None\n");
-			break;
+	const Stickmap *stickmap = getSelectedStickmap();
+	if (stickmap != NULL) {
+		printStr("%s\n", stickmap->name);
+		printStr("%s", stickmap->desc);
+	} else {
+		printStr("None\n");
+	}
+	
+	// let whoever wrote the file know if something's wrong with it
+	printStr("\nStickmaps can be added in /GTS/stickmaps.txt, ");
+	if (stickmapImportResult == -1) {
+		printStr("none were found.");
+	} else if (stickmapImportResult == 0) {
+		printStr("which was loaded.");
+	} else {
+		printStr("which couldn't be loaded because of line %d.", stickmapImportResult);
 	}
 	setWordWrap(false);
 	endScrollingPrint();
@@ -475,7 +252,7 @@ void menu_coordView() {
 			printStr("):");
 			
 			//setCursorPos(6, 15);
-			int stickmapRetVal = isCoordValid(selectedStickmap, stickMelee);
+			const Stickmap *stickmap = getSelectedStickmap();
 			setPrintOffset(8);
 			setCursorPos(6, 0);
 			
@@ -489,102 +266,48 @@ void menu_coordView() {
 			printStr("Result:");
 			
 			setPrintOffset(4);
-			switch (selectedStickmap) {
-				case FF_WD:
-					setCursorPos(5, 2);
-					printStr("Firefox/Wavedash");
-					
-					setPrintOffset(12);
-					setCursorPos(7, 2);
-					// TODO: look into manually spacing these due to highlighted text,
-					//  or having it manually handled...
-					//setCursorXY(20, (7 * (PRINT_FONT_CHAR_HEIGHT + LINE_SPACING)) + 5);
-					if (selectedStickmapSub == 0) {
-						printStr("ALL");
-					} else {
-						printStrColor(STICKMAP_FF_WD_RETCOLORS[selectedStickmapSub][0], STICKMAP_FF_WD_RETCOLORS[selectedStickmapSub][1],
-						              STICKMAP_FF_WD_RETVALS[selectedStickmapSub]);
-					}
-					
-					setPrintOffset(4);
-					setCursorPos(15, 2);
-					printStrColor(STICKMAP_FF_WD_RETCOLORS[stickmapRetVal][0], STICKMAP_FF_WD_RETCOLORS[stickmapRetVal][1],
-					              STICKMAP_FF_WD_RETVALS[stickmapRetVal]);
-					break;
-				case SHIELDDROP:
-					setCursorPos(5, 2);
-					printStr("Shield Drop");
-					
-					setPrintOffset(12);
-					setCursorPos(7, 2);
-					if (selectedStickmapSub == 0) {
-						printStr("ALL");
-					} else {
-						printStrColor(STICKMAP_SHIELDDROP_RETCOLORS[selectedStickmapSub][0], STICKMAP_SHIELDDROP_RETCOLORS[selectedStickmapSub][1],
-						              STICKMAP_SHIELDDROP_RETVALS[selectedStickmapSub]);
-					}
-					
-					setPrintOffset(4);
-					setCursorPos(15, 2);
-					printStrColor(STICKMAP_SHIELDDROP_RETCOLORS[stickmapRetVal][0], STICKMAP_SHIELDDROP_RETCOLORS[stickmapRetVal][1],
-					              STICKMAP_SHIELDDROP_RETVALS[stickmapRetVal]);
-					break;
-				case NONE:
-				default:
-					setCursorPos(5, 2);
-					printStr("NONE");
-					
-					setPrintOffset(12);
-					setCursorPos(7, 2);
-					printStr("N/A");
-					
-					setPrintOffset(4);
-					setCursorPos(15, 2);
-					printStr("N/A");
-					break;
+			if (stickmap != NULL) {
+				setCursorPos(5, 2);
+				printStr("%s", stickmap->name);
+				
+				setPrintOffset(12);
+				setCursorPos(7, 2);
+				// TODO: look into manually spacing these due to highlighted text,
+				//  or having it manually handled...
+				//setCursorXY(20, (7 * (PRINT_FONT_CHAR_HEIGHT + LINE_SPACING)) + 5);
+				if (selectedStickmapSub == 0) {
+					printStr("ALL");
+				} else {
+					printStickmapRegion(&stickmap->regions[selectedStickmapSub]);
+				}
+				
+				setPrintOffset(4);
+				setCursorPos(15, 2);
+				printStickmapRegion(&stickmap->regions[getStickmapRegionIndex(stickmap, stickMelee)]);
+			} else {
+				setCursorPos(5, 2);
+				printStr("NONE");
+				
+				setPrintOffset(12);
+				setCursorPos(7, 2);
+				printStr("N/A");
+				
+				setPrintOffset(4);
+				setCursorPos(15, 2);
+				printStr("N/A");
 			}
 			setPrintOffset(0);
 			
-			// calculate screen coordinates for stick position drawing
-			int xfbCoordX = (stickMelee.stickXUnit / 125) * 2;
-			if (stickRaw.stickX < 0) {
-				xfbCoordX *= -1;
-			}
-			xfbCoordX += COORD_CIRCLE_CENTER_X;
-			
-			int xfbCoordY = (stickMelee.stickYUnit / 125) * 2;
-			if (stickRaw.stickY > 0) {
-				xfbCoordY *= -1;
-			}
-			xfbCoordY += SCREEN_POS_CENTER_Y;
-			
-			int xfbCoordCX = (stickMelee.cStickXUnit / 125) * 2;
-			if (stickRaw.cStickX < 0) {
-				xfbCoordCX *= -1;
-			}
-			xfbCoordCX += COORD_CIRCLE_CENTER_X;
-			
-			int xfbCoordCY = (stickMelee.cStickYUnit / 125) * 2;
-			if (stickRaw.cStickY > 0) {
-				xfbCoordCY *= -1;
-			}
-			xfbCoordCY += SCREEN_POS_CENTER_Y;
-			
 			changeLoadedTexmap(TEXMAP_STICKOUTLINE);
 			setDepthForDrawCall(-15);
 			drawTextureFullScaled(COORD_CIRCLE_CENTER_X - 164, SCREEN_POS_CENTER_Y - 164,
 			                      COORD_CIRCLE_CENTER_X + 163, SCREEN_POS_CENTER_Y + 163,
 			                      GX_COLOR_WHITE);
 			
-			drawStickmapOverlay(selectedStickmap, selectedStickmapSub);
-			
-			// draw analog stick line
-			drawLine(COORD_CIRCLE_CENTER_X, SCREEN_POS_CENTER_Y, xfbCoordX, xfbCoordY, GX_COLOR_WHITE);
-			drawBox(xfbCoordX - 4, xfbCoordY - 4, xfbCoordX + 4, xfbCoordY + 4, GX_COLOR_WHITE);
+			drawStickmapOverlay(stickmap, selectedStickmapSub);
 			
-			// draw c-stick line
-			drawLine(COORD_CIRCLE_CENTER_X, SCREEN_POS_CENTER_Y, xfbCoordCX, xfbCoordCY, GX_COLOR_YELLOW);
-			drawSolidBox(xfbCoordCX - 2, xfbCoordCY - 2, xfbCoordCX + 2, xfbCoordCY + 2, GX_COLOR_YELLOW);
+			// stick positions are drawn in drawStickCursors(), right before the frame goes out
+			setLateLatchDraw(drawStickCursors);
 			
 			if (!menuLockEnabled) {
 				if (*pressed & PAD_TRIGGER_Z && menuState) {
@@ -595,63 +318,39 @@ void menu_coordView() {
 			break;
 		case COORD_VIEW_INSTRUCTIONS:
 			displayInstructions();
+			menu_setFrameStatic();
 			break;
 	}
 	
 	// cycle stickmap
+	int stickmapChoices = getStickmapCount(STICKMAP_UNITS_MELEE) + 1;
+	const Stickmap *selected = getSelectedStickmap();
+	int regionChoices = (selected == NULL) ? 1 : selected->regionCount;
 	if (*pressed == PAD_BUTTON_LEFT) {
 		selectedStickmapSub = 0;
 		if (selectedStickmap == 0) {
-			selectedStickmap = 2;
+			selectedStickmap = stickmapChoices - 1;
 		} else {
 			selectedStickmap--;
 		}
 	} else if (*pressed == PAD_BUTTON_RIGHT) {
 		selectedStickmap++;
 		selectedStickmapSub = 0;
-		if (selectedStickmap == 3) {
+		if (selectedStickmap == stickmapChoices) {
 			selectedStickmap = 0;
 		}
 	}
 	// cycle stickmap categories
 	else if (*pressed == PAD_BUTTON_UP) {
 		selectedStickmapSub++;
-		switch (selectedStickmap) {
-			case (FF_WD):
-				if (selectedStickmapSub == STICKMAP_FF_WD_ENUM_LEN) {
-					selectedStickmapSub = 0;
-				}
-				break;
-			case (SHIELDDROP):
-				if (selectedStickmapSub == STICKMAP_SHIELDDROP_ENUM_LEN) {
-					selectedStickmapSub = 0;
-				}
-				break;
-			case (NONE):
-			default:
-				selectedStickmapSub = 0;
-				break;
+		if (selectedStickmapSub >= regionChoices) {
+			selectedStickmapSub = 0;
 		}
 	} else if (*pressed == PAD_BUTTON_DOWN) {
-		switch (selectedStickmap) {
-			case (FF_WD):
-				if (selectedStickmapSub == 0) {
-					selectedStickmapSub = STICKMAP_FF_WD_ENUM_LEN - 1;
-				} else {
-					selectedStickmapSub--;
-				}
-				break;
-			case (SHIELDDROP):
-				if (selectedStickmapSub == 0) {
-					selectedStickmapSub = STICKMAP_SHIELDDROP_ENUM_LEN - 1;
-				} else {
-					selectedStickmapSub--;
-				}
-				break;
-			case (NONE):
-			default:
-				selectedStickmapSub = 0;
-				break;
+		if (selectedStickmapSub == 0) {
+			selectedStickmapSub = regionChoices - 1;
+		} else {
+			selectedStickmapSub--;
 		}
 	}
 	
@@ -5,6 +5,7 @@
 #include "submenu/gate.h"
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <ogc/pad.h>
 #include <ogc/timesupp.h>
@@ -12,6 +13,7 @@
 #include "util/gx.h"
 #include "util/polling.h"
 #include "util/print.h"
+#include "util/file.h"
 
 static enum GATE_MENU_STATE menuState = GATE_SETUP;
 static enum GATE_STATE state = GATE_INIT;
@@ -25,16 +27,62 @@ static sampling_callback cb;
 static uint64_t prevSampleCallbackTick = 0;
 static uint64_t sampleCallbackTick = 0;
 
-typedef struct GateMinMax {
+// the gate is stored as a polar envelope, the furthest point seen in each slice of the circle
+// this is updated as samples come in, so the outline is always ready to draw (or export)
+typedef struct GateOutlinePoint {
 	bool init;
-	int8_t min;
-	int8_t max;
-	int8_t cMin;
-	int8_t cMax;
-} GateMinMax;
-static GateMinMax gateMinMax[256] = { 0 };
+	int8_t x;
+	int8_t y;
+	uint16_t radiusSq;
+} GateOutlinePoint;
+// analog stick, c-stick
+static GateOutlinePoint gateOutline[2][GATE_OUTLINE_BINS] = { 0 };
 static bool showC = false;
 
+static int exportReturnCode = -1;
+
+// atan(i / 64), in units where 1024 is a full turn
+static const uint8_t ATAN_LUT[65] = { 0, 3, 5, 8, 10, 13, 15, 18, 20, 23, 25, 28, 30, 33, 35, 38,
+                                      40, 42, 45, 47, 49, 52, 54, 56, 58, 61, 63, 65, 67, 69, 71, 74,
+                                      76, 78, 80, 82, 84, 85, 87, 89, 91, 93, 95, 96, 98, 100, 102, 103,
+                                      105, 106, 108, 110, 111, 113, 114, 116, 117, 119, 120, 121, 123, 124, 125, 127,
+                                      128 };
+
+// which slice x, y falls into, counterclockwise from +x
+// this runs in the sampling callback, so it sticks to integer math
+static int getOutlineBin(int x, int y) {
+	int absX = abs(x), absY = abs(y);
+	int angle;
+	// get the angle in the first octant, then mirror it to where it should be
+	if (absX >= absY) {
+		angle = ATAN_LUT[(absY * 64 + absX / 2) / absX];
+	} else {
+		angle = 256 - ATAN_LUT[(absX * 64 + absY / 2) / absY];
+	}
+	if (x < 0) {
+		angle = 512 - angle;
+	}
+	if (y < 0) {
+		angle = 1024 - angle;
+	}
+	return ((angle & 1023) * GATE_OUTLINE_BINS) / 1024;
+}
+
+static void addOutlineSample(GateOutlinePoint *outline, int x, int y) {
+	uint16_t radiusSq = (x * x) + (y * y);
+	// too close to the origin to say anything about the angle
+	if (radiusSq < GATE_OUTLINE_MIN_RADIUS * GATE_OUTLINE_MIN_RADIUS) {
+		return;
+	}
+	GateOutlinePoint *point = &outline[getOutlineBin(x, y)];
+	if (!point->init || radiusSq > point->radiusSq) {
+		point->x = x;
+		point->y = y;
+		point->radiusSq = radiusSq;
+		point->init = true;
+	}
+}
+
 void gateSamplingCallback() {
 	// time from last call of this function calculation
 	prevSampleCallbackTick = sampleCallbackTick;
@@ -43,35 +91,28 @@ void gateSamplingCallback() {
 	readController(false);
 	
 	if (menuState == GATE_POST_SETUP && state == GATE_POST_INIT) {
-		int currX = PAD_StickX(0), currY = PAD_StickY(0);
-		int currCX = PAD_SubStickX(0), currCY = PAD_SubStickY(0);
-		
 		if (showC) {
-			if (!gateMinMax[currCX + 128].init) {
-				gateMinMax[currCX + 128].init = true;
-			}
-			if (gateMinMax[currCX + 128].cMin > currCY) {
-				gateMinMax[currCX + 128].cMin = currCY;
-			}
-			if (gateMinMax[currCX + 128].cMax < currCY) {
-				gateMinMax[currCX + 128].cMax = currCY;
-			}
+			addOutlineSample(gateOutline[1], PAD_SubStickX(0), PAD_SubStickY(0));
 		} else {
-			if (!gateMinMax[currX + 128].init) {
-				gateMinMax[currX + 128].init = true;
-			}
-			
-			if (gateMinMax[currX + 128].min > currY) {
-				gateMinMax[currX + 128].min = currY;
-			}
-			if (gateMinMax[currX + 128].max < currY) {
-				gateMinMax[currX + 128].max = currY;
-			}
+			addOutlineSample(gateOutline[0], PAD_StickX(0), PAD_StickY(0));
 		}
 	}
 	
 }
 
+int getGateOutline(bool cStick, int8_t points[GATE_OUTLINE_BINS][2]) {
+	int count = 0;
+	GateOutlinePoint *outline = gateOutline[cStick ? 1 : 0];
+	for (int i = 0; i < GATE_OUTLINE_BINS; i++) {
+		if (outline[i].init) {
+			points[count][0] = outline[i].x;
+			points[count][1] = outline[i].y;
+			count++;
+		}
+	}
+	return count;
+}
+
 static void setup() {
 	if (pressed == NULL) {
 		pressed = getButtonsDownPtr();
@@ -90,18 +131,19 @@ static void displayInstructions() {
 	printStr("or the C-Stick");
 	drawFontButton(FONT_STICK_C);
 	printStr("\naround its gate to measure.\n\n"
-			 "As data is captured, points will begin to show the gate\'s "
-			 "outline.\n\n"
-			 "Phob visualizations can have two quirks: \n"
-			 "- Small gaps around the cardinals, and user-defined\n notches\n"
-			 "- Points may appear inside the gate, close to\n the origin\n\n"
-			 "Neither of these are an issue, and can be ignored.\n\n"
+			 "As data is captured, the gate\'s outline will begin to show.\n\n"
+			 "Phob visualizations can have small gaps around the\n"
+			 "cardinals, and user-defined notches. This is not an\n"
+			 "issue, and can be ignored.\n\n"
 			 "Press X");
 	drawFontButton(FONT_Y);
 	printStr("to toggle which stick is being visualized.\n"
 			 "Hold Y");
 	drawFontButton(FONT_X);
-	printStr("to reset the current visualization.");
+	printStr("to reset the current visualization.\n"
+			 "Press A");
+	drawFontButton(FONT_A);
+	printStr("to export the outline to the SD card.");
 	setWordWrap(false);
 	
 	if (isControllerConnected(CONT_PORT_1)) {
@@ -131,14 +173,12 @@ void menu_gateMeasure() {
 			switch (state) {
 				case GATE_INIT:
 					// reset data
-					for (int i = 0; i < 256; i++) {
-						gateMinMax[i].init = false;
-						gateMinMax[i].min = 0;
-						gateMinMax[i].max = 0;
-						gateMinMax[i].cMin = 0;
-						gateMinMax[i].cMax = 0;
+					for (int i = 0; i < GATE_OUTLINE_BINS; i++) {
+						gateOutline[0][i].init = false;
+						gateOutline[1][i].init = false;
 					}
 					showC = false;
+					exportReturnCode = -1;
 					yPressFrameCounter = 0;
 					state = GATE_POST_INIT;
 				case GATE_POST_INIT:
@@ -184,47 +224,49 @@ void menu_gateMeasure() {
 						        GX_COLOR_WHITE);
 					}
 					
-					// draw each
-					int totalPoints = 0;
-					int validPointIndexes[256] = {0};
-					
-					// figure out how many points we need to draw
-					for (int i = 0; i < 256; i++) {
-						if (gateMinMax[i].init) {
-							validPointIndexes[totalPoints] = i;
-							totalPoints++;
+					// connect neighboring slices, anything that hasn't been reached yet is left as a gap
+					// drawLine() is batched, so this all ends up as one draw
+					GateOutlinePoint *outline = gateOutline[showC ? 1 : 0];
+					setDepth(-5);
+					for (int i = 0; i < GATE_OUTLINE_BINS; i++) {
+						GateOutlinePoint *curr = &outline[i];
+						GateOutlinePoint *next = &outline[(i + 1) % GATE_OUTLINE_BINS];
+						if (curr->init && next->init) {
+							drawLine(COORD_CIRCLE_CENTER_X + curr->x, SCREEN_POS_CENTER_Y - curr->y,
+							         COORD_CIRCLE_CENTER_X + next->x, SCREEN_POS_CENTER_Y - next->y,
+							         GX_COLOR_SILVER);
 						}
 					}
+					restorePrevDepth();
 					
-					GX_SetPointSize(12, GX_TO_ZERO);
-					// totalPoints * 2 because each entry in the array contains both min and max
-					GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, totalPoints * 2);
-					
-					// TODO: there's a better way to do this, right?
-					if (showC) {
-						for (int i = 0; i < totalPoints; i++) {
-							GX_Position3s16(COORD_CIRCLE_CENTER_X - 128 + validPointIndexes[i], SCREEN_POS_CENTER_Y - gateMinMax[validPointIndexes[i]].cMax, -5);
-							GX_Color4u8(GX_COLOR_SILVER.r, GX_COLOR_SILVER.g, GX_COLOR_SILVER.b, GX_COLOR_SILVER.a);
-							
-							GX_Position3s16(COORD_CIRCLE_CENTER_X - 128 + validPointIndexes[i], SCREEN_POS_CENTER_Y - gateMinMax[validPointIndexes[i]].cMin, -5);
-							GX_Color4u8(GX_COLOR_SILVER.r, GX_COLOR_SILVER.g, GX_COLOR_SILVER.b, GX_COLOR_SILVER.a);
-						}
-					} else {
-						for (int i = 0; i < totalPoints; i++) {
-							GX_Position3s16(COORD_CIRCLE_CENTER_X - 128 + validPointIndexes[i], SCREEN_POS_CENTER_Y - gateMinMax[validPointIndexes[i]].max, -5);
-							GX_Color4u8(GX_COLOR_SILVER.r, GX_COLOR_SILVER.g, GX_COLOR_SILVER.b, GX_COLOR_SILVER.a);
-							
-							GX_Position3s16(COORD_CIRCLE_CENTER_X - 128 + validPointIndexes[i], SCREEN_POS_CENTER_Y - gateMinMax[validPointIndexes[i]].min, -5);
-							GX_Color4u8(GX_COLOR_SILVER.r, GX_COLOR_SILVER.g, GX_COLOR_SILVER.b, GX_COLOR_SILVER.a);
-						}
+					setCursorPos(9, 0);
+					printStr("Export (A");
+					drawFontButton(FONT_A);
+					printStr(")");
+					setCursorPos(10, 2);
+					switch (exportReturnCode) {
+						case -1:
+							break;
+						case 0:
+							printStr("Exported");
+							break;
+						case 1:
+							printStr("No outline yet");
+							break;
+						default:
+							printStr("Failed (%d)", exportReturnCode);
+							break;
 					}
-					GX_End();
-					
 					
 					if (*pressed & PAD_TRIGGER_Z) {
 						menuState = GATE_INSTRUCTIONS;
 					} else if (*pressed & PAD_BUTTON_Y) {
 						showC = !showC;
+						exportReturnCode = -1;
+					} else if (*pressed & PAD_BUTTON_A) {
+						int8_t points[GATE_OUTLINE_BINS][2];
+						int count = getGateOutline(showC, points);
+						exportReturnCode = exportGateOutline(points, count, showC);
 					}
 					
 					if (*held & PAD_BUTTON_X) {
@@ -244,6 +286,7 @@ void menu_gateMeasure() {
 			break;
 		case GATE_INSTRUCTIONS:
 			displayInstructions();
+			menu_setFrameStatic();
 			break;
 	}
 }
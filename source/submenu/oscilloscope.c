@@ -16,6 +16,8 @@
 #include "util/print.h"
 #include "util/gx.h"
 #include "util/polling.h"
+#include "analysis.h"
+#include "spectrum.h"
 
 const static uint8_t STICK_MOVEMENT_THRESHOLD = 15;
 const static uint8_t STICK_MOVEMENT_TIME_THRESHOLD_MS = 25;
@@ -47,6 +49,15 @@ static bool recordingInProgress = false;
 static enum CONTROLLER_STICK_AXIS displayedAxis = AXIS_AXY;
 static enum CONTROLLER_STICK_AXIS triggeringAxis = AXIS_AX;
 
+// overlay of what the game would read, and where in the frame those reads happen
+static bool showGameReads = false;
+static uint8_t gameReadPhaseMs = 0;
+
+static enum SNAPBACK_PAGE snapbackPage = SNAPBACK_PAGE_MIN_MAX;
+
+// frequency content of the recording, in place of the waveform
+static bool showSpectrum = false;
+
 static uint8_t ellipseCounter = 0;
 static uint64_t prevSampleCallbackTick = 0;
 static uint64_t sampleCallbackTick = 0;
@@ -55,6 +66,18 @@ static uint64_t timeStickInOrigin = 0;
 static uint16_t *pressed = NULL;
 static uint16_t *held = NULL;
 
+// test results for the displayed recording
+// these sweep every phase of the game's poll, so they're only redone when the recording or axis changes
+static PivotResult pivotResult;
+static DashbackResult dashbackResult;
+static SnapbackResult snapbackResult;
+static SpectrumResult spectrumResult;
+#ifdef BENCH
+static uint32_t spectrumTimeUs = 0;
+#endif
+static uint32_t resultRevision = 0;
+static enum CONTROLLER_STICK_AXIS resultAxis = AXIS_AXY;
+
 static sampling_callback cb;
 static void oscilloscopeCallback() {
 	// time from last call of this function calculation
@@ -374,6 +397,21 @@ static void displayInstructions() {
 	drawFontButton(FONT_STICK_C);
 	printStr(".");
 	
+	printStr("\n\nPress");
+	fontButtonSetDpadDirections(FONT_DPAD_UP);
+	drawFontButton(FONT_DPAD);
+	printStr("to show what Melee would read each frame over the waveform. Melee reads the stick once "
+			 "per frame, so press");
+	fontButtonSetDpadDirections(FONT_DPAD_LEFT | FONT_DPAD_RIGHT);
+	drawFontButton(FONT_DPAD);
+	printStr("to move where in the frame those reads happen.");
+	
+	printStr("\n\nPress R");
+	drawFontButton(FONT_R);
+	printStr("to show how much of each frequency is in the recording instead, starting from where "
+			 "the stick was let go. A tall bar is something like spring ringing, lots of small bars "
+			 "are noise.");
+	
 	printStr("\n\nCURRENT TEST (X");
 	drawFontButton(FONT_X);
 	printStr("): ");
@@ -383,7 +421,14 @@ static void displayInstructions() {
 					"Check the min/max value on a given axis depending on where "
 					"the stick started. The range in which Melee will not register "
 					"a directional input is -22 to +22. Anything outside that range "
-					"risks the game registering a non-neutral stick input.");
+					"risks the game registering a non-neutral stick input.\n"
+					"Press");
+			fontButtonSetDpadDirections(FONT_DPAD_DOWN);
+			drawFontButton(FONT_DPAD);
+			printStr("to cycle between the min/max, how far the stick overshot and how "
+					"long it took to settle within +/-5, and how it rang around center. "
+					"Frames >22 is the most frames Melee could read past the deadzone on "
+					"the other side.");
 			break;
 		case PIVOT:
 			printStr("PIVOT\n"
@@ -418,6 +463,91 @@ static void displayInstructions() {
 	}
 }
 
+static void updateTestResults(ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis) {
+	if (rec->revision == resultRevision && axis == resultAxis) {
+		return;
+	}
+	analyzePivot(rec, axis, &pivotResult);
+	analyzeDashback(rec, axis, &dashbackResult);
+	analyzeSnapback(rec, axis, SNAPBACK_SETTLE_UNITS, &snapbackResult);
+	// start from the release, so that any ringing is what fills the window
+	#ifdef BENCH
+	uint64_t spectrumStartTick = gettime();
+	#endif
+	analyzeSpectrum(rec, axis, snapbackResult.valid ? snapbackResult.releaseIndex : 0, &spectrumResult);
+	#ifdef BENCH
+	spectrumTimeUs = ticks_to_microsecs(gettime() - spectrumStartTick);
+	#endif
+	resultRevision = rec->revision;
+	resultAxis = axis;
+}
+
+// some test logic always uses the 'triggeringAxis',
+// so data would be wrong if we showed it when the other axis is shown
+static enum CONTROLLER_STICK_AXIS getWorkingAxis() {
+	enum CONTROLLER_STICK_AXIS workingAxis = triggeringAxis;
+	if (displayedAxis == AXIS_AXY) {
+		if (triggeringAxis == AXIS_CX) {
+			workingAxis = AXIS_AX;
+		}
+		if (triggeringAxis == AXIS_CY) {
+			workingAxis = AXIS_AY;
+		}
+	} else if (displayedAxis == AXIS_CXY) {
+		if (triggeringAxis == AXIS_AX) {
+			workingAxis = AXIS_CX;
+		}
+		if (triggeringAxis == AXIS_AY) {
+			workingAxis = AXIS_CY;
+		}
+	}
+	return workingAxis;
+}
+
+// bars for each frequency over the graph area, with a line every 100 Hz
+static void drawSpectrum(ControllerRec *rec, enum CONTROLLER_STICK_AXIS axis) {
+	updateTestResults(rec, axis);
+	
+	setCursorPos(3, 4);
+	printStr("Spectrum: %3d ms from sample %4d | %.2f Hz per bar",
+	         (spectrumResult.windowSamples * SPECTRUM_SAMPLE_US) / 1000, spectrumResult.startIndex,
+	         SPECTRUM_BIN_HZ);
+	
+	setDepth(-8);
+	for (int hz = 100; hz < 500; hz += 100) {
+		int xPos = SCREEN_TIMEPLOT_START + (int) ((hz * 2) / SPECTRUM_BIN_HZ);
+		drawLine(xPos, SCREEN_POS_CENTER_Y - 127, xPos, SCREEN_POS_CENTER_Y + 127, GX_COLOR_DARKGREEN);
+	}
+	restorePrevDepth();
+	
+	setCursorPos(20, 0);
+	uint16_t peak = spectrumResult.magnitude[spectrumResult.peakBin];
+	if (spectrumResult.peakBin == 0 || peak == 0) {
+		printStr("No movement to measure.");
+		return;
+	}
+	
+	// two pixels per bar, everything is scaled to the biggest one
+	GXColor color = (axis == AXIS_AX || axis == AXIS_CX) ? GX_COLOR_RED_X : GX_COLOR_BLUE_Y;
+	setDepth(-2);
+	for (int i = 1; i < SPECTRUM_BINS && (i * 2) < 500; i++) {
+		int height = (spectrumResult.magnitude[i] * 254) / peak;
+		if (height != 0) {
+			drawSolidBox(SCREEN_TIMEPLOT_START + (i * 2), SCREEN_POS_CENTER_Y + 127 - height,
+			             SCREEN_TIMEPLOT_START + (i * 2) + 1, SCREEN_POS_CENTER_Y + 127, color);
+		}
+	}
+	restorePrevDepth();
+	
+	// the window is padded if the recording is shorter, which makes everything smaller by the same amount
+	float amplitude = ((float) peak * SPECTRUM_SIZE) / (spectrumResult.windowSamples * SPECTRUM_MAGNITUDE_ONE);
+	printStr("Peak: %5.1f Hz | Amplitude: %4.1f | Lines: 100 Hz",
+	         spectrumResult.peakBin * SPECTRUM_BIN_HZ, amplitude);
+	#ifdef BENCH
+	printStr(" | %4u us", spectrumTimeUs);
+	#endif
+}
+
 // only run once
 static void setup() {
 	setSamplingRateHigh();
@@ -477,6 +607,8 @@ void menu_oscilloscope() {
 							oState = POST_INPUT;
 						}
 					} else {
+						// nothing changes until the lock is released
+						menu_setFrameStatic();
 						setCursorPos(2, 25);
 						printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "LOCKED");
 						setCursorPos(2, 35);
@@ -518,37 +650,40 @@ void menu_oscilloscope() {
 					setDepth(-8);
 					// lots of the specific values are taken from:
 					// https://github.com/PhobGCC/PhobGCC-doc/blob/main/For_Users/Phobvision_Guide_Latest.md
-					switch (currentTest) {
-						case PIVOT:
-							drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y + 64,
-									 SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 64, GX_COLOR_DARKGREEN);
-							drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y - 64,
-									  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 64, GX_COLOR_DARKGREEN);
-							setCursorPos(8, 0);
-							printStr("+64");
-							setCursorPos(15, 0);
-							printStr("-64");
-							break;
-						case DASHBACK:
-							drawLine(SCREEN_TIMEPLOT_START,  SCREEN_POS_CENTER_Y + 64,
-									  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 64, GX_COLOR_DARKGREEN);
-							drawLine(SCREEN_TIMEPLOT_START,  SCREEN_POS_CENTER_Y - 64,
-									  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 64, GX_COLOR_DARKGREEN);
-							setCursorPos(8, 0);
-							printStr("+64");
-							setCursorPos(15, 0);
-							printStr("-64");
-						case SNAPBACK:
-							drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y + 23,
-									  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 23, GX_COLOR_DARKGREEN);
-							drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y - 23,
-									  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 23, GX_COLOR_DARKGREEN);
-							setCursorPos(10, 0);
-							printStr("+23");
-							setCursorPos(13, 0);
-							printStr("-23");
-						default:
-							break;
+					// the spectrum isn't in stick units, so none of these apply to it
+					if (!showSpectrum) {
+						switch (currentTest) {
+							case PIVOT:
+								drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y + 64,
+										 SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 64, GX_COLOR_DARKGREEN);
+								drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y - 64,
+										  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 64, GX_COLOR_DARKGREEN);
+								setCursorPos(8, 0);
+								printStr("+64");
+								setCursorPos(15, 0);
+								printStr("-64");
+								break;
+							case DASHBACK:
+								drawLine(SCREEN_TIMEPLOT_START,  SCREEN_POS_CENTER_Y + 64,
+										  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 64, GX_COLOR_DARKGREEN);
+								drawLine(SCREEN_TIMEPLOT_START,  SCREEN_POS_CENTER_Y - 64,
+										  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 64, GX_COLOR_DARKGREEN);
+								setCursorPos(8, 0);
+								printStr("+64");
+								setCursorPos(15, 0);
+								printStr("-64");
+							case SNAPBACK:
+								drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y + 23,
+										  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y + 23, GX_COLOR_DARKGREEN);
+								drawLine(SCREEN_TIMEPLOT_START, SCREEN_POS_CENTER_Y - 23,
+										  SCREEN_TIMEPLOT_START + 500, SCREEN_POS_CENTER_Y - 23, GX_COLOR_DARKGREEN);
+								setCursorPos(10, 0);
+								printStr("+23");
+								setCursorPos(13, 0);
+								printStr("-23");
+							default:
+								break;
+						}
 					}
 					restorePrevDepth();
 					
@@ -565,7 +700,13 @@ void menu_oscilloscope() {
 						drawFontButton(FONT_A);
 						printStr(")");
 						
+						if (showSpectrum) {
+							drawSpectrum(dispData, getWorkingAxis());
+							break;
+						}
+						
 						setDrawGraphStickAxis(displayedAxis);
+						setDrawGraphGameReads(showGameReads, gameReadPhaseMs * 1000);
 						setDepthForDrawCall(-2);
 						drawGraph(dispData, GRAPH_STICK, (oState == POST_INPUT_LOCK && stickCooldown == 0));
 						
@@ -594,297 +735,57 @@ void menu_oscilloscope() {
 						// print test data
 						setCursorPos(20, 0);
 						
-						// some test logic always uses the 'triggeringAxis',
-						// so data would be wrong if we showed it when the other axis is shown
-						enum CONTROLLER_STICK_AXIS workingAxis = triggeringAxis;
-						if (displayedAxis == AXIS_AXY) {
-							if (triggeringAxis == AXIS_CX) {
-								workingAxis = AXIS_AX;
-							}
-							if (triggeringAxis == AXIS_CY) {
-								workingAxis = AXIS_AY;
-							}
-						} else if (displayedAxis == AXIS_CXY) {
-							if (triggeringAxis == AXIS_AX) {
-								workingAxis = AXIS_CX;
-							}
-							if (triggeringAxis == AXIS_AY) {
-								workingAxis = AXIS_CY;
-							}
-						}
+						enum CONTROLLER_STICK_AXIS workingAxis = getWorkingAxis();
 						
 						switch (currentTest) {
 							case SNAPBACK:
-								// highlight axis with biggest magnitude
-								// if tied, preference will go to X
-								if (yIsBiggerMagnitude) {
-									printStr("X Min, Max: (%4d,%4d)  |  ", minX, maxX);
-									printStrBox(GX_COLOR_WHITE, "Y Min, Max: (%4d,%4d)", minY, maxY);
-								} else {
-									printStrBox(GX_COLOR_WHITE, "X Min, Max: (%4d,%4d)", minX, maxX);
-									printStr("  |  Y Min, Max: (%4d,%4d)", minY, maxY);
-								}
-								break;
-							case PIVOT:
-								bool pivotHit80 = false;
-								bool prevPivotHit80 = false;
-								bool leftPivotRange = false;
-								bool prevLeftPivotRange = false;
-								int pivotStartIndex = -1, pivotEndIndex = -1;
-								int pivotStartSign = 0;
-								// start from the back of the list
-								for (int i = dispData->sampleEnd - 1; i >= 0; i--) {
-									int8_t curr = getControllerSampleAxisValue(dispData->samples[i], workingAxis);
-									// check current coordinate for +-64 (dash threshold)
-									if ((abs(curr) >= 64) && !leftPivotRange) {
-										if (pivotEndIndex == -1) {
-											pivotEndIndex = i;
-										}
-										// pivot input must hit 80 on both sides
-										if (abs(curr) >= 80) {
-											pivotHit80 = true;
+								updateTestResults(dispData, workingAxis);
+								switch (snapbackPage) {
+									case SNAPBACK_PAGE_SETTLE:
+										printStr("Overshoot: %4d | ", snapbackResult.overshoot);
+										if (snapbackResult.settled) {
+											printStr("Settle: %5.1f ms", snapbackResult.settleTimeUs / 1000.0);
+										} else {
+											printStrColor(GX_COLOR_NONE, GX_COLOR_RED, "Settle: >%4.0f ms",
+											              snapbackResult.settleTimeUs / 1000.0);
 										}
-										// check if we didn't poll between the dash thresholds
-										// (dolphin w/ bad pode)?
-										if (pivotEndIndex != -1 && !leftPivotRange &&
-										    (curr * getControllerSampleAxisValue(dispData->samples[pivotEndIndex], workingAxis) < 0)) {
-											leftPivotRange = true;
-											pivotStartIndex = i;
+										// past the deadzone is what actually matters in game
+										printStr(" | ");
+										if (snapbackResult.deadzoneFramesMax != 0) {
+											printStrBox(GX_COLOR_RED, "Frames >22: %d", snapbackResult.deadzoneFramesMax);
+										} else {
+											printStr("Frames >22: 0");
 										}
-									}
-									
-									// are we outside the pivot range and have already logged data of being in range
-									if (pivotEndIndex != -1 && abs(curr) < 64) {
-										leftPivotRange = true;
-										if (pivotStartIndex == -1) {
-											// need the "previous" poll since this one is out of the range
-											pivotStartIndex = i + 1;
-										}
-										if (prevLeftPivotRange || !pivotHit80) {
-											break;
-										}
-									}
-									
-									// look for the initial input
-									if (abs(curr) >= 64 && leftPivotRange) {
-										// used to ensure starting input is from the opposite side
-										if (pivotStartSign == 0) {
-											pivotStartSign = curr;
-										}
-										prevLeftPivotRange = true;
-										if (abs(curr) >= 80) {
-											prevPivotHit80 = true;
-											break;
-										}
-									}
-								}
-								
-								// phobvision doc says both sides need to hit 80 to succeed
-								// multiplication is to ensure signs are correct
-								int8_t pivotLastValue = getControllerSampleAxisValue(dispData->samples[pivotEndIndex], workingAxis);
-
-								if (prevPivotHit80 && pivotHit80 && (pivotLastValue * pivotStartSign < 0)) {
-									float noTurnPercent = 0;
-									float pivotPercent = 0;
-									float dashbackPercent = 0;
-
-									uint64_t timeInPivotRangeUs = 0;
-									for (int i = pivotStartIndex; i <= pivotEndIndex; i++) {
-										timeInPivotRangeUs += dispData->samples[i].timeDiffUs;
-									}
-
-									// convert time to float in milliseconds
-									float timeInPivotRangeMs = (timeInPivotRangeUs / 1000.0);
-
-									// TODO: i think the calculation can be simplified here...
-									// how many milliseconds could a poll occur that would cause a miss
-									float diffFrameTimePoll = FRAME_TIME_MS_F - timeInPivotRangeMs;
-
-									// negative time difference, dashback
-									if (diffFrameTimePoll < 0) {
-										dashbackPercent = ((diffFrameTimePoll * -1) / FRAME_TIME_MS_F) * 100;
-										if (dashbackPercent > 100) {
-											dashbackPercent = 100;
-										}
-										pivotPercent = 100 - dashbackPercent;
-										// positive or 0 time diff, no turn
-									} else {
-										noTurnPercent = (diffFrameTimePoll / FRAME_TIME_MS_F) * 100;
-										if (noTurnPercent > 100) {
-											noTurnPercent = 100;
+										break;
+									case SNAPBACK_PAGE_RINGING:
+										printStr("Crossings: %2d | Ringing: %4.1f Hz | Decay: %5.1f ms",
+										         snapbackResult.zeroCrossings, snapbackResult.ringingHz,
+										         snapbackResult.decayMs);
+										break;
+									case SNAPBACK_PAGE_MIN_MAX:
+									default:
+										// highlight axis with biggest magnitude
+										// if tied, preference will go to X
+										if (yIsBiggerMagnitude) {
+											printStr("X Min, Max: (%4d,%4d)  |  ", minX, maxX);
+											printStrBox(GX_COLOR_WHITE, "Y Min, Max: (%4d,%4d)", minY, maxY);
+										} else {
+											printStrBox(GX_COLOR_WHITE, "X Min, Max: (%4d,%4d)", minX, maxX);
+											printStr("  |  Y Min, Max: (%4d,%4d)", minY, maxY);
 										}
-										pivotPercent = 100 - noTurnPercent;
-									}
-
-									printStr("%5.1f ms | NoTurn: %3.0f%% | Pivot: %3.0f%% | Dashback: %3.0f%%",
-											timeInPivotRangeMs, noTurnPercent, pivotPercent, dashbackPercent);
-								} else {
-									printStr("  0.0 ms | NoTurn:   0%% | Pivot:   0%% | Dashback: 100%%");
-									//printStr("prev %d piv %d last %d start %d", prevPivotHit80, pivotHit80, pivotLastValue, pivotStartSign);
+										break;
 								}
 								break;
+							case PIVOT:
+								updateTestResults(dispData, workingAxis);
+								printStr("%5.1f ms | NoTurn: %3.0f%% | Pivot: %3.0f%% | Dashback: %3.0f%%",
+								         pivotResult.timeInRangeUs / 1000.0, pivotResult.noTurnPercent,
+								         pivotResult.pivotPercent, pivotResult.dashbackPercent);
+								break;
 							case DASHBACK:
-								// go forward in list
-								int dashbackStartIndex = -1, dashbackEndIndex = -1;
-								uint64_t timeInRange = 0;
-								bool stickInDashRange = false;
-								
-								// iterate over the list, find the start and end point where the X axis is in the
-								// slow-turn range [23,63]
-								// we also check if the X axis reaches the dash range (64+)
-								for (int i = 0; i < dispData->sampleEnd; i++) {
-									int8_t curr = abs(getControllerSampleAxisValue(dispData->samples[i], workingAxis));
-									// is the stick in the dash range?
-									// note that this is independent from the other if
-									if (curr >= 65) {
-										// mark that we did cross that threshold
-										stickInDashRange = true;
-										// did we miss the slow-turn range?
-										if (dashbackStartIndex == -1) {
-											break;
-										}
-									}
-									
-									// is the stick in the slow-turn range
-									if ((curr >= 23 && curr < 64)) {
-										timeInRange += dispData->samples[i].timeDiffUs;
-										// set this as the first sample that is in slow-turn range
-										if (dashbackStartIndex == -1) {
-											dashbackStartIndex = i;
-										}
-									} else if (dashbackStartIndex != -1) {
-										dashbackEndIndex = i - 1;
-										// stick has left the slow-turn range, there's no need to continue
-										// checking the list
-										break;
-									}
-								}
-								
-								float dashbackPercent = 0.0;
-								float ucfPercent = 0.0;
-								
-								if (dashbackEndIndex == -1) {
-									// stick did not get polled in slow-turn range, but did get to dash range,
-									// so this should pass???
-									if (stickInDashRange) {
-										dashbackPercent = 100;
-										ucfPercent = 100;
-									}
-									// stick did not hit dash range, fail
-									else {
-										dashbackPercent = 0.0;
-										ucfPercent = 0.0;
-									}
-								} else {
-									// convert time in microseconds to float time in milliseconds
-									float timeInRangeMs = (timeInRange / 1000.0);
-
-									// vanilla dashback is just the amount of time the stick was in the slow-turn range
-									// over the total time for one frame
-									// (subtracted from 1.0 because we want to show the _success_ rate)
-									dashbackPercent = (1.0 - (timeInRangeMs / FRAME_TIME_MS_F)) * 100;
-
-									// ucf dashback is a little more involved
-									
-									// we iterate over each sample in the slow-turn range, calculate what the next
-									// frame would be based on that sample, and check if it meets the requirements
-									// for the dash-intention check (total units moved across those two frame >75)
-									uint64_t ucfTimeInRange = timeInRange;
-									for (int i = dashbackStartIndex; i <= dashbackEndIndex; i++) {
-										// for ucf testing, we need to find the samples that occur on both the
-										// previous frame and the frame after
-										uint64_t usFromPoll = 0;
-										int nextPollIndex = i, prevPollIndex = i;
-										
-										// first find poll that would occur around 1f before
-										// if this fails to find a poll due to running out of data, we'll assume
-										// the poll happened around the origin
-										while (usFromPoll < FRAME_TIME_US && prevPollIndex >= 0) {
-											usFromPoll += dispData->samples[prevPollIndex].timeDiffUs;
-											prevPollIndex--;
-										}
-										
-										// reset this since we reuse it...
-										usFromPoll = 0;
-										
-										// now find the poll that would occur around 1f after
-										while (usFromPoll < FRAME_TIME_US && nextPollIndex != dispData->sampleEnd) {
-											nextPollIndex++;
-											usFromPoll += dispData->samples[nextPollIndex].timeDiffUs;
-										}
-										
-										// exit if we've hit the end of the list somehow
-										// idk how this would happen except _maybe_ on box
-										if (usFromPoll < FRAME_TIME_US) {
-											break;
-										}
-										
-										// ucf dash intention check
-										// the two frames need to move more than 75 units for UCF to convert it.
-										// there are two cases we handle here:
-										// - one where we found a poll ~1f before
-										// - one where we do _not_ find a poll ~1f before
-										// in the first case, we calculate how many total units the stick moved from
-										// that previous poll, and in the second case we assume the poll was
-										// around the origin, so we can just use the second poll's value as the total
-										int8_t dashIntentionCount = 0;
-										
-										// first case: we need to actually find the total units moved
-										if (prevPollIndex >= 0) {
-											dashIntentionCount = abs(
-													getControllerSampleAxisValue(dispData->samples[prevPollIndex], workingAxis) -
-													getControllerSampleAxisValue(dispData->samples[i], workingAxis) );
-											
-											dashIntentionCount += abs(
-													getControllerSampleAxisValue(dispData->samples[i], workingAxis) -
-													getControllerSampleAxisValue(dispData->samples[nextPollIndex], workingAxis) );
-										}
-										// second case: we assume previous poll is at origin (0,0), and just use
-										// the value in nextPollIndex
-										else {
-											dashIntentionCount = abs(getControllerSampleAxisValue(dispData->samples[nextPollIndex], workingAxis));
-										}
-										
-										// did the stick move enough units to trigger the dash intention check?
-										if (dashIntentionCount > 75) {
-											// since we're iterating over each sample in the slow-turn range,
-											// if the dash intention check passes, we subtract its time from
-											// the total time that a slow-turn _could_ occur.
-											// in theory, after this loops finishes, ucfTimeInRange will only contain
-											// the time when the dash intention check could fail.
-											ucfTimeInRange -= dispData->samples[i].timeDiffUs;
-										}
-									}
-
-									float ucfTimeInRangeMs = ucfTimeInRange / 1000.0;
-									
-									// this means all of the samples in the dash range passed the intention check,
-									// so we give it 100%
-									if (ucfTimeInRangeMs <= 0) {
-										ucfPercent = 100;
-									} else {
-										// one or more samples didn't pass the intention check, do normal calculation
-										ucfPercent = (1.0 - (ucfTimeInRangeMs / FRAME_TIME_MS_F)) * 100;
-									}
-
-									// this shouldn't happen in theory, maybe on box?
-									if (dashbackPercent > 100) {
-										dashbackPercent = 100;
-									}
-									if (ucfPercent > 100) {
-										ucfPercent = 100;
-									}
-									// this definitely can happen though
-									if (dashbackPercent < 0) {
-										dashbackPercent = 0;
-									}
-									if (ucfPercent < 0) {
-										ucfPercent = 0;
-									}
-								}
-								
+								updateTestResults(dispData, workingAxis);
 								printStr("Vanilla Success: %2.0f%% | UCF Success: %2.0f%%",
-								         dashbackPercent, ucfPercent);
+								         dashbackResult.vanillaPercent, dashbackResult.ucfPercent);
 								break;
 							default:
 								printStr("Error?");
@@ -921,6 +822,19 @@ void menu_oscilloscope() {
 					break;
 			}
 			
+			setCursorPos(21, 31);
+			printStr("Game Frames (");
+			fontButtonSetDpadDirections(FONT_DPAD_UP);
+			drawFontButton(FONT_DPAD);
+			printStr("): ");
+			if (showGameReads) {
+				printStr("+%2u ms", gameReadPhaseMs);
+				fontButtonSetDpadDirections(FONT_DPAD_LEFT | FONT_DPAD_RIGHT);
+				drawFontButton(FONT_DPAD);
+			} else {
+				printStr("Off");
+			}
+			
 			// check for inputs
 			// pan and zoom are handled by drawGraph()
 			if (*pressed & PAD_BUTTON_A && oState != PRE_INPUT) {
@@ -937,10 +851,22 @@ void menu_oscilloscope() {
 				} else {
 					displayedAxis = AXIS_AXY;
 				}
+			} else if (*pressed & PAD_BUTTON_UP) {
+				showGameReads = !showGameReads;
+			} else if (showGameReads && *pressed & PAD_BUTTON_RIGHT) {
+				// phases 0 to 16 ms, a frame is ~16.6 ms
+				gameReadPhaseMs = (gameReadPhaseMs + 1) % 17;
+			} else if (showGameReads && *pressed & PAD_BUTTON_LEFT) {
+				gameReadPhaseMs = (gameReadPhaseMs + 16) % 17;
+			} else if (currentTest == SNAPBACK && *pressed & PAD_BUTTON_DOWN) {
+				snapbackPage = (snapbackPage + 1) % SNAPBACK_PAGE_LEN;
+			} else if (*pressed & PAD_TRIGGER_R) {
+				showSpectrum = !showSpectrum;
 			}
 			break;
 		case OSC_INSTRUCTIONS:
 			displayInstructions();
+			menu_setFrameStatic();
 			break;
 		default:
 			printStr("How did we get here?");
@@ -12,6 +12,8 @@
 
 #include "util/print.h"
 #include "util/polling.h"
+#include "util/file.h"
+#include "stickmap.h"
 
 // orange for button press samples
 #define COLOR_ORANGE 0xAD1EADBA
@@ -45,19 +47,37 @@ static int map2dStartIndex = 0;
 static int lastDrawPoint = -1;
 static bool showCStick = false;
 
+// heatmap view, replaces individual points with how long the stick was at each coordinate
+// every recording made in the menu gets added, until the stick is changed
+static bool showHeatmap = false;
+static uint32_t heatmapRevision = 0;
+
 static bool autoCapture = false;
 static int autoCaptureCounter = 0;
 static bool autoCaptureStartReleased = true;
 
-// enum for what image to draw in 2d plot
-static enum IMAGE selectedImage = NO_IMAGE;
-static enum IMAGE selectedImageCopy = NO_IMAGE;
+// stickmap drawn behind the plot, 0 is none, otherwise the raw stickmap at (selectedStickmap - 1)
+// the copy is the other stick's selection, see the Y button
+static int selectedStickmap = 0;
+static int selectedStickmapCopy = 0;
 
 static sampling_callback cb;
 static uint64_t prevSampleCallbackTick = 0;
 static uint64_t sampleCallbackTick = 0;
 static uint8_t ellipseCounter = 0;
 
+static const Stickmap *getSelectedStickmap() {
+	return (selectedStickmap == 0) ? NULL : getStickmap(STICKMAP_UNITS_RAW, selectedStickmap - 1);
+}
+
+// move the selection by direction, skipping stickmaps that aren't meant for the c-stick if it's shown
+static void cycleStickmap(int direction) {
+	int stickmapChoices = getStickmapCount(STICKMAP_UNITS_RAW) + 1;
+	do {
+		selectedStickmap = (selectedStickmap + direction + stickmapChoices) % stickmapChoices;
+	} while (showCStick && selectedStickmap != 0 && !getSelectedStickmap()->cStick);
+}
+
 static void plot2dSamplingCallback() {
 	// time from last call of this function calculation
 	prevSampleCallbackTick = sampleCallbackTick;
@@ -193,6 +213,9 @@ static void setup() {
 		temp = getTempData();
 	}
 	
+	initStickmaps();
+	importStickmaps();
+	
 	cb = PAD_SetSamplingCallback(plot2dSamplingCallback);
 	menuState = PLOT_POST_SETUP;
 	plotState = PLOT_DISPLAY;
@@ -205,6 +228,8 @@ static void setup() {
 	}
 	
 	showCStick = false;
+	clearHeatmap();
+	heatmapRevision = 0;
 	resetScrollingPrint();
 }
 
@@ -237,6 +262,12 @@ static void displayInstructions() {
 			 "Press Y");
 	drawFontButton(FONT_Y);
 	printStr("to toggle which stick is captured.\n\n"
+			 "Press L");
+	drawFontButton(FONT_L);
+	printStr("+ R");
+	drawFontButton(FONT_R);
+	printStr("to toggle the heatmap, which shows every recording "
+			 "made for the current stick.\n\n"
 			 "Hold Start");
 	drawFontButton(FONT_START);
 	printStr("to toggle Auto-Trigger. Enabling this removes "
@@ -334,42 +365,27 @@ void menu_plot2d() {
 					drawFontButton(FONT_DPAD);
 					printStr(":  ");
 					setCursorPos(5, 2);
-					switch (selectedImage) {
-						case A_WAIT:
-							printStr("Wait Attacks");
-							break;
-						case CROUCH:
-							printStr("Crouch");
-							break;
-						case DEADZONE:
-							printStr("Deadzones");
-							break;
-						case LEDGE_L:
-							printStr("Left Ledge");
-							break;
-						case LEDGE_R:
-							printStr("Right Ledge");
-							break;
-						case MOVE_WAIT:
-							printStr("Wait Movement");
-							break;
-						case NO_IMAGE:
-							printStr("None");
-						default:
-							break;
-					}
-					
-					updateVtxDesc(VTX_TEXTURES, GX_MODULATE);
-					changeLoadedTexmap(TEXMAP_STICKMAPS);
-					changeStickmapTexture((int) selectedImage);
-					
-					// draw image
-					if (selectedImage != NO_IMAGE) {
+					const Stickmap *stickmap = getSelectedStickmap();
+					if (stickmap != NULL) {
+						printStr("%s", stickmap->name);
+						
+						// one texel per stick coordinate, same as the heatmap
+						changeStickmapTexture(stickmap);
+						updateVtxDesc(VTX_TEXTURES, GX_MODULATE);
+						changeLoadedTexmap(TEXMAP_STICKMAPS);
 						setDepthForDrawCall(-8);
 						drawTextureFull(COORD_CIRCLE_CENTER_X - 128, SCREEN_POS_CENTER_Y - 128, GX_COLOR_WHITE);
+					} else {
+						printStr("None");
 					}
 					
 					if (dispData->isRecordingReady) {
+						// new recording, add it to the heatmap
+						if (dispData->revision != heatmapRevision) {
+							addHeatmapSamples(dispData, showCStick ? AXIS_CXY : AXIS_AXY, 0, dispData->sampleEnd);
+							heatmapRevision = dispData->revision;
+						}
+						
 						convertedCoords = convertStickRawToMelee(dispData->samples[lastDrawPoint]);
 						
 						// print coordinates of last drawn point
@@ -412,8 +428,22 @@ void menu_plot2d() {
 							printStr("R ");
 						}
 						
-						setCursorPos(17, 0);
-						//printStr("Zone: %s", "TEMP");
+						// stickmap region of last drawn point
+						if (stickmap != NULL) {
+							const ControllerSample *sample = &dispData->samples[lastDrawPoint];
+							int regionIndex;
+							if (!showCStick) {
+								regionIndex = getStickmapRawRegionIndex(stickmap, sample->stickX, sample->stickY);
+							} else {
+								regionIndex = getStickmapRawRegionIndex(stickmap, sample->cStickX, sample->cStickY);
+							}
+							const StickmapRegion *region = &stickmap->regions[regionIndex];
+							// region colors are stored as rgb, so the stickmap module doesn't need ogc
+							GXColor regionColor = { region->color[0], region->color[1], region->color[2], 0xFF };
+							GXColor textColor = { region->textColor[0], region->textColor[1], region->textColor[2], 0xFF };
+							setCursorPos(6, 2);
+							printStrColor(regionColor, textColor, "%s", region->name);
+						}
 						
 						// we need to calculate vertices ahead of time
 						
@@ -437,60 +467,53 @@ void menu_plot2d() {
 						int dataIndex = map2dStartIndex;
 						int currFrameInterval = 0;
 						
-						updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-						
-						// this is <= because lastDrawPoint is zero indexed
-						while (dataIndex <= lastDrawPoint) {
-							// is our current datapoint a frame interval?
-							if (dataIndex == frameIntervalList[currFrameInterval]) {
-								GX_SetPointSize(32, GX_TO_ZERO);
-								GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, 1);
-								if (!showCStick) {
-									GX_Position3s16(COORD_CIRCLE_CENTER_X + dispData->samples[dataIndex].stickX,
-									                SCREEN_POS_CENTER_Y - dispData->samples[dataIndex].stickY, -4);
-								} else {
-									GX_Position3s16(COORD_CIRCLE_CENTER_X + dispData->samples[dataIndex].cStickX,
-									                SCREEN_POS_CENTER_Y - dispData->samples[dataIndex].cStickY, -4);
-								}
-								if (dispData->samples[dataIndex].buttons != 0) {
-									GX_Color4u8(GX_COLOR_ORANGE.r, GX_COLOR_ORANGE.g, GX_COLOR_ORANGE.b, GX_COLOR_ORANGE.a);
-								} else {
-									GX_Color4u8(GX_COLOR_WHITE.r, GX_COLOR_WHITE.g, GX_COLOR_WHITE.b, GX_COLOR_WHITE.b);
-								}
-								currFrameInterval++;
-								dataIndex++;
-							}
-							// samples between frame interval
-							else {
-								GX_SetPointSize(8, GX_TO_ZERO);
-								
-								int pointsToDraw;
-								if (currFrameInterval != frameIntervalIndex) {
-									pointsToDraw = frameIntervalList[currFrameInterval] - dataIndex;
-								} else {
-									pointsToDraw = lastDrawPoint - dataIndex + 1;
-								}
-								
-								GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, pointsToDraw);
-								
-								int endPoint = dataIndex + pointsToDraw;
-								while (dataIndex < endPoint) {
-									if (!showCStick) {
-										GX_Position3s16(COORD_CIRCLE_CENTER_X + dispData->samples[dataIndex].stickX,
-										                SCREEN_POS_CENTER_Y - dispData->samples[dataIndex].stickY, -4);
-									} else {
-										GX_Position3s16(COORD_CIRCLE_CENTER_X + dispData->samples[dataIndex].cStickX,
-										                SCREEN_POS_CENTER_Y - dispData->samples[dataIndex].cStickY, -4);
+						// heatmap is drawn instead of points, one quad no matter how many samples there are
+						if (showHeatmap) {
+							setDepthForDrawCall(-4);
+							drawHeatmap(COORD_CIRCLE_CENTER_X - 128, SCREEN_POS_CENTER_Y - 128, GX_COLOR_WHITE);
+						} else {
+							// points come straight from the recording, see startRecordingPoints()
+							setDepthForDrawCall(-4);
+							startRecordingPoints(dispData, showCStick ? AXIS_CXY : AXIS_AXY,
+							                     COORD_CIRCLE_CENTER_X, SCREEN_POS_CENTER_Y);
+							
+							// switching point size for every frame interval is a draw call each,
+							// if we're short on time, draw all samples in one go and the intervals in another
+							if (getRenderDetail() == DETAIL_FULL) {
+								// this is <= because lastDrawPoint is zero indexed
+								while (dataIndex <= lastDrawPoint) {
+									// is our current datapoint a frame interval?
+									if (dataIndex == frameIntervalList[currFrameInterval]) {
+										setPointSize(32);
+										drawRecordingPoints(dataIndex, 1);
+										currFrameInterval++;
+										dataIndex++;
 									}
-									if (dispData->samples[dataIndex].buttons != 0) {
-										GX_Color4u8(GX_COLOR_ORANGE.r, GX_COLOR_ORANGE.g, GX_COLOR_ORANGE.b, GX_COLOR_WHITE.b);
-									} else {
-										GX_Color4u8(GX_COLOR_WHITE.r, GX_COLOR_WHITE.g, GX_COLOR_WHITE.b, GX_COLOR_WHITE.b);
+									// samples between frame interval
+									else {
+										setPointSize(8);
+										
+										int pointsToDraw;
+										if (currFrameInterval != frameIntervalIndex) {
+											pointsToDraw = frameIntervalList[currFrameInterval] - dataIndex;
+										} else {
+											pointsToDraw = lastDrawPoint - dataIndex + 1;
+										}
+										
+										drawRecordingPoints(dataIndex, pointsToDraw);
+										dataIndex += pointsToDraw;
 									}
-									dataIndex++;
+								}
+							} else {
+								setPointSize(8);
+								drawRecordingPoints(map2dStartIndex, lastDrawPoint - map2dStartIndex + 1);
+								if (getRenderDetail() != DETAIL_MINIMAL && frameIntervalIndex > 0) {
+									setPointSize(32);
+									drawRecordingPointList(frameIntervalList, frameIntervalIndex);
 								}
 							}
-							GX_End();
+							
+							endRecordingPoints();
 						}
 						
 						// highlight last sample with a box
@@ -629,22 +652,9 @@ void menu_plot2d() {
 					// we want up/down to be pressed, and nothing else held
 					// checking *pressed here lets this be a one-shot until the button is released
 					if (*pressed == PAD_BUTTON_UP && *held == PAD_BUTTON_UP) {
-						selectedImage++;
-						if (!showCStick) {
-							selectedImage %= IMAGE_LEN;
-						} else {
-							// only first 3 options are valid for c-stick
-							selectedImage %= 3;
-						}
+						cycleStickmap(1);
 					} else if (*pressed == PAD_BUTTON_DOWN && *held == PAD_BUTTON_DOWN) {
-						selectedImage--;
-						if (selectedImage == -1) {
-							if (!showCStick) {
-								selectedImage = IMAGE_LEN - 1;
-							} else {
-								selectedImage = 2;
-							}
-						}
+						cycleStickmap(-1);
 					}
 					
 					if (*pressed & PAD_TRIGGER_Z && !autoCapture && plotState != PLOT_INPUT) {
@@ -654,9 +664,16 @@ void menu_plot2d() {
 						showCStick = !showCStick;
 						
 						// store and swap stickmaps
-						enum IMAGE temp = selectedImageCopy;
-						selectedImageCopy = selectedImage;
-						selectedImage = temp;
+						int temp = selectedStickmapCopy;
+						selectedStickmapCopy = selectedStickmap;
+						selectedStickmap = temp;
+						
+						// heatmap is only for one stick, start over with the current recording
+						clearHeatmap();
+						heatmapRevision = 0;
+					} else if (*pressed & (PAD_TRIGGER_L | PAD_TRIGGER_R) &&
+					           (*held & (PAD_TRIGGER_L | PAD_TRIGGER_R)) == (PAD_TRIGGER_L | PAD_TRIGGER_R)) {
+						showHeatmap = !showHeatmap;
 					}
 					
 					if ((*pressed & PAD_BUTTON_A && !autoCapture) || captureStart) {
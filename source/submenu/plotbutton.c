@@ -352,11 +352,11 @@ void menu_plotButton() {
 						ButtonPressedTime buttons[13] = { {0, false} };
 						
 						// initial "frame" line
-						GX_SetLineWidth(8, GX_TO_ZERO);
+						setLineWidth(8);
 						drawLine(SCREEN_BUTTONPLOT_START, SCREEN_TIMEPLOT_Y_TOP,
 								 SCREEN_BUTTONPLOT_START, SCREEN_TIMEPLOT_Y_BOTTOM,
 								 GX_COLOR_SILVER);
-						GX_SetLineWidth(12, GX_TO_ZERO);
+						setLineWidth(12);
 						
 						int currMs = 0;
 						int frameIntervalIndex = 0;
@@ -369,11 +369,11 @@ void menu_plotButton() {
 							if (totalTimeUs >= (1000 * currMs)) {
 								currMs++;
 								if (totalTimeUs / 1000 >= FRAME_INTERVAL_MS[frameIntervalIndex]) {
-									GX_SetLineWidth(6, GX_TO_ZERO);
+									setLineWidth(6);
 									drawLine(SCREEN_BUTTONPLOT_START + (currMs * 2), SCREEN_TIMEPLOT_Y_TOP,
 												  SCREEN_BUTTONPLOT_START + (currMs * 2), SCREEN_TIMEPLOT_Y_BOTTOM,
 												  GX_COLOR_GRAY);
-									GX_SetLineWidth(12, GX_TO_ZERO);
+									setLineWidth(12);
 									
 									/*
 									if (menuDisplay400) {
@@ -478,11 +478,11 @@ void menu_plotButton() {
 						}
 						
 						// draw end line
-						GX_SetLineWidth(8, GX_TO_ZERO);
+						setLineWidth(8);
 						drawLine(SCREEN_BUTTONPLOT_START + (currMs * 2), SCREEN_TIMEPLOT_Y_TOP,
 						              SCREEN_BUTTONPLOT_START + (currMs * 2), SCREEN_TIMEPLOT_Y_BOTTOM,
 						              GX_COLOR_SILVER);
-						GX_SetLineWidth(12, GX_TO_ZERO);
+						setLineWidth(12);
 						/*if (menuDisplay400) {
 							DrawVLine(SCREEN_BUTTONPLOT_START + currMs, SCREEN_TIMEPLOT_Y_TOP,
 							          SCREEN_TIMEPLOT_Y_BOTTOM,
@@ -7,7 +7,7 @@
 
 // Upstream URL for the PhobGCC project is: https://github.com/PhobGCC/PhobGCC-SW
 
-// Other than adt ps math, this mostly clones the visual side of phobvision
+// This mostly clones the visual side of phobvision, the adt ps math is in analysis.c
 
 #include "submenu/trigger.h"
 
@@ -20,6 +20,7 @@
 #include "waveform.h"
 #include "util/polling.h"
 #include "util/print.h"
+#include "analysis.h"
 
 const static int TRIGGER_SAMPLES = 500;
 
@@ -260,63 +261,25 @@ void menu_triggerOscilloscope() {
 						
 						setCursorPos(3, 24);
 						
-						// calculate projectile powershield percentages
-						// mostly based on phobvision code:
-						// https://github.com/PhobGCC/PhobGCC-SW/blob/main/PhobGCC/rp2040/src/main.cpp#L581
-						float psDigital = 0.0, psADT = 0.0, psNone = 0.0;
-						uint64_t timeInAnalogRangeUs = 0;
-						int sampleDigitalBegin = -1;
 						switch (dispData->recordingType) {
 							case REC_TRIGGER_L:
 								printStr("L Trigger");
-								for (int i = 0; i < dispData->sampleEnd; i++) {
-									if (dispData->samples[i].buttons & PAD_TRIGGER_L) {
-										sampleDigitalBegin = i;
-										break;
-									}
-									if (dispData->samples[i].triggerL > 42) {
-										timeInAnalogRangeUs += dispData->samples[i].timeDiffUs;
-									}
-								}
 								break;
 							case REC_TRIGGER_R:
 								printStr("R Trigger");
-								for (int i = 0; i < dispData->sampleEnd; i++) {
-									if (dispData->samples[i].buttons & PAD_TRIGGER_R) {
-										sampleDigitalBegin = i;
-										break;
-									}
-									if (dispData->samples[i].triggerR > 42) {
-										timeInAnalogRangeUs += dispData->samples[i].timeDiffUs;
-									}
-								}
 								break;
 							default:
 								printStr("Capture selection invalid");
 								break;
 						}
 						
-						// float representing percent of a frame
-						float analogRangeFrame = (timeInAnalogRangeUs / 1000.0) / FRAME_TIME_MS_F;
-						
-						// digital press never occurred
-						if (sampleDigitalBegin == -1) {
-							// do nothing
-						// time before digital press is more than a frame
-						} else if (analogRangeFrame > 1) {
-							psADT = 100 * (2 - analogRangeFrame);
-							if (psADT < 0) {
-								psADT = 0;
-							}
-							psNone = 100 - psADT;
-						// time before digital press is less than/equal to a frame
-						} else {
-							psDigital = 100 * (1 - analogRangeFrame);
-							psADT = 100 - psDigital;
-						}
+						// projectile powershield percentages
+						PowershieldResult powershield;
+						analyzePowershield(dispData, &powershield);
 						
 						setCursorPos(20, 4);
-						printStr("Digital PS: %4.0f%% | ADT PS: %4.0f%% | No PS: %4.0f%%", psDigital, psADT, psNone);
+						printStr("Digital PS: %4.0f%% | ADT PS: %4.0f%% | No PS: %4.0f%%", powershield.digitalPercent,
+						         powershield.adtPercent, powershield.nonePercent);
 
 						if (*pressed & PAD_BUTTON_A) {
 							if (trigState == TRIG_DISPLAY) {
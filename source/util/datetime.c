@@ -51,15 +51,6 @@ enum DATE_CHECK_LIST checkDate() {
 		return forcedDate;
 	}
 	
-	if (initFilesystem()) {
-		FILE *fileCheck = fopen("/GTS/color.txt", "r");
-		
-		if (fileCheck != NULL) {
-			fclose(fileCheck);
-			return DATE_PM;
-		}
-	}
-	
 	struct tm * timeinfo = getCurrTimeInfo();
 	
 	if (timeinfo->tm_mon == 3) {
@@ -80,4 +71,22 @@ enum DATE_CHECK_LIST checkDate() {
 	
 	return DATE_NONE;
 }
+
+bool checkDateFile() {
+	// forced dates take priority
+	if (forceDateSet) {
+		return false;
+	}
+	
+	if (initFilesystem()) {
+		FILE *fileCheck = fopen("/GTS/color.txt", "r");
+		
+		if (fileCheck != NULL) {
+			fclose(fileCheck);
+			return true;
+		}
+	}
+	
+	return false;
+}
 #endif
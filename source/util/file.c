@@ -9,32 +9,86 @@
 #include <inttypes.h>
 
 #include <ogc/pad.h>
+#include <ogc/lwp.h>
 
 #include "waveform.h"
 #include "util/print.h"
 #include "util/file.h"
+#include "util/startup.h"
+#include "analysis.h"
+#include "stickmap.h"
+#include "inputevents.h"
 
 // appended to the file, in order to prevent files from being overwritten
 // technically this can only occur if someone exports multiple in one second
 static unsigned int increment = 0;
 
+// game reads are exported for every poll phase in steps of this many microseconds
+#define GAME_READ_EXPORT_STEP_US 1000
+static int exportReadIndices[REC_SAMPLE_MAX];
+
 static bool initSuccess = false, initAttempted = false;
 
+// probing the sd card can take a while, so startFilesystemInit() does it on a separate thread
+static lwp_t initThread = (lwp_t) NULL;
+static volatile bool initThreadDone = false;
+
+static void *initFilesystemThread(void *args) {
+	initSuccess = fatInitDefault();
+	markStartupPhase(STARTUP_FILESYSTEM);
+	initThreadDone = true;
+	return NULL;
+}
+
+// anything that actually needs the filesystem has to wait for the thread
+static void waitForInitThread() {
+	if (initThread != (lwp_t) NULL) {
+		LWP_JoinThread(initThread, NULL);
+		initThread = (lwp_t) NULL;
+	}
+}
+
+void startFilesystemInit() {
+	if (!initAttempted) {
+		initAttempted = true;
+		LWP_CreateThread(&initThread, initFilesystemThread, NULL, NULL, 2048, LWP_PRIO_NORMAL);
+	}
+}
+
+bool isFilesystemInitDone() {
+	return initAttempted && (initThread == (lwp_t) NULL || initThreadDone);
+}
+
 bool initFilesystem() {
 	if (!initAttempted) {
 		initAttempted = true;
 		initSuccess = fatInitDefault();
+		markStartupPhase(STARTUP_FILESYSTEM);
 	}
+	waitForInitThread();
 	return initSuccess;
 }
 
 // deinit fs if necessary
 void deinitFilesystem() {
+	waitForInitThread();
 	if (initSuccess) {
 		fatDeinit();
 	}
 }
 
+// create directory if it doesn't exist
+// https://stackoverflow.com/questions/7430248/creating-a-new-directory-in-c
+bool createGTSDirectory() {
+	struct stat st = {0};
+	if (stat("/GTS", &st) == -1) {
+		if (mkdir("/GTS", 0700) == -1) {
+			return false;
+		}
+	}
+	return true;
+}
+
 FILE *openFile(char *filename, char *modes) {
 	if (!initFilesystem()) {
 		return NULL;
@@ -57,6 +111,56 @@ FILE *openFile(char *filename, char *modes) {
 	return retFile;
 }
 
+// what the game would read from the recording, see resampleRecording()
+// one row per frame, for every phase in steps of GAME_READ_EXPORT_STEP_US
+static int exportGameReads(ControllerRec *data, char *fileStr) {
+	FILE *fptr = openFile(fileStr, "w");
+	if (fptr == NULL) {
+		return 5;
+	}
+	
+	// phase, frame number, index of the sample that gets read, then the same values as REC_BUTTONTIME
+	fprintf(fptr, "phase_us,frame,sample,x,y,cx,cy,l,r,buttons\n");
+	for (uint32_t phaseUs = 0; phaseUs < FRAME_TIME_US; phaseUs += GAME_READ_EXPORT_STEP_US) {
+		int readCount = resampleRecording(data, phaseUs, exportReadIndices, REC_SAMPLE_MAX);
+		for (int i = 0; i < readCount; i++) {
+			ControllerSample *sample = &data->samples[exportReadIndices[i]];
+			fprintf(fptr, "%" PRIu32 ",%d,%d,%d,%d,%d,%d,%u,%u,%" PRIu16 "\n",
+			        phaseUs, i, exportReadIndices[i], sample->stickX, sample->stickY,
+			        sample->cStickX, sample->cStickY, sample->triggerL, sample->triggerR, sample->buttons);
+		}
+	}
+	
+	fclose(fptr);
+	return 0;
+}
+
+// snapback results for each stick axis, see analyzeSnapback()
+static int exportSnapback(ControllerRec *data, char *fileStr) {
+	FILE *fptr = openFile(fileStr, "w");
+	if (fptr == NULL) {
+		return 6;
+	}
+	
+	static const char *axisNames[] = { "x", "y", "cx", "cy" };
+	fprintf(fptr, "axis,release,release_sample,overshoot,settled,settle_us,zero_crossings,ringing_hz,decay_ms,"
+	              "deadzone_frames_max,deadzone_frames_avg\n");
+	for (enum CONTROLLER_STICK_AXIS axis = AXIS_AX; axis <= AXIS_CY; axis++) {
+		SnapbackResult result;
+		analyzeSnapback(data, axis, SNAPBACK_SETTLE_UNITS, &result);
+		if (!result.valid) {
+			continue;
+		}
+		fprintf(fptr, "%s,%d,%d,%d,%d,%" PRIu64 ",%d,%.2f,%.2f,%d,%.3f\n",
+		        axisNames[axis], result.releaseValue, result.releaseIndex, result.overshoot, result.settled,
+		        result.settleTimeUs, result.zeroCrossings, result.ringingHz, result.decayMs,
+		        result.deadzoneFramesMax, result.deadzoneFramesAvg);
+	}
+	
+	fclose(fptr);
+	return 0;
+}
+
 int exportData() {
 	ControllerRec *data = *(getRecordingData());
 	data->dataExported = true;
@@ -72,15 +176,8 @@ int exportData() {
 	// get current time in YY-MM-DD_HH-MM-SS format
 	char *timeStr = getDateTimeStr();
 	
-	// create directory if it doesn't exist
-	// https://stackoverflow.com/questions/7430248/creating-a-new-directory-in-c
-	{
-		struct stat st = {0};
-		if (stat("/GTS", &st) == -1) {
-			if (mkdir("/GTS", 0700) == -1) {
-				return 3;
-			}
-		}
+	if (!createGTSDirectory()) {
+		return 3;
 	}
 	
 	// create filepath
@@ -96,6 +193,12 @@ int exportData() {
 		increment %= 10;
 	}
 	
+	// game reads go in a second file next to the recording, so the recording's format doesn't change
+	char gameReadFileStr[80];
+	snprintf(gameReadFileStr, 80, "%s_frames.csv", fileStr);
+	char snapbackFileStr[80];
+	snprintf(snapbackFileStr, 80, "%s_snapback.csv", fileStr);
+	
 	strcat(fileStr, ".csv");
 	
 	{
@@ -189,5 +292,128 @@ int exportData() {
 	
 	free(timeStr);
 	
+	int ret = exportGameReads(data, gameReadFileStr);
+	if (ret != 0 || data->recordingType != REC_OSCILLOSCOPE) {
+		return ret;
+	}
+	return exportSnapback(data, snapbackFileStr);
+}
+
+int exportGateOutline(int8_t points[][2], int count, bool cStick) {
+	if (count == 0) {
+		return 1;
+	}
+	
+	if (!initFilesystem()) {
+		return 2;
+	}
+	
+	if (!createGTSDirectory()) {
+		return 3;
+	}
+	
+	char *timeStr = getDateTimeStr();
+	char fileStr[64];
+	snprintf(fileStr, 64, "/GTS/gate_%s.csv", timeStr);
+	
+	FILE *fptr = openFile(fileStr, "w");
+	if (fptr == NULL) {
+		free(timeStr);
+		return 4;
+	}
+	
+	// first row is: datetime, number of points, which stick (0 analog, 1 c-stick)
+	fprintf(fptr, "%s,%d,%d\n", timeStr, count, cStick);
+	// rest are x, y, ordered counterclockwise from +x
+	for (int i = 0; i < count; i++) {
+		fprintf(fptr, "%d,%d\n", points[i][0], points[i][1]);
+	}
+	
+	fclose(fptr);
+	
+	free(timeStr);
+	
+	return 0;
+}
+
+int exportInputEvents(const InputEventDetector *detector) {
+	int count = getInputEventBufferedCount(detector);
+	if (count == 0) {
+		return 1;
+	}
+	
+	if (!initFilesystem()) {
+		return 2;
+	}
+	
+	if (!createGTSDirectory()) {
+		return 3;
+	}
+	
+	char *timeStr = getDateTimeStr();
+	char fileStr[64];
+	snprintf(fileStr, 64, "/GTS/events_%s.csv", timeStr);
+	
+	FILE *fptr = openFile(fileStr, "w");
+	if (fptr == NULL) {
+		free(timeStr);
+		return 4;
+	}
+	
+	// first row is: datetime, number of events, events detected in total (older ones aren't kept)
+	fprintf(fptr, "%s,%d,%" PRIu32 "\n", timeStr, count, detector->eventCount);
+	// melee x and y are the decimal part, like the coordinate viewer
+	// angle is only for wavedashes, region is only for shield drops
+	fprintf(fptr, "frame,sample,event,direction,detail,x,y,angle,region\n");
+	for (int i = 0; i < count; i++) {
+		const InputEvent *event = getInputEvent(detector, i);
+		fprintf(fptr, "%" PRIu32 ",%" PRIu32 ",%s,%d,%u,%d,%d,", event->frame, event->sampleNumber,
+		        getInputEventName(event->type), event->direction, event->detail, event->meleeX, event->meleeY);
+		if (event->type == EVENT_WAVEDASH) {
+			fprintf(fptr, "%.2f", getInputEventAngle(event));
+		}
+		fprintf(fptr, ",");
+		if (event->type == EVENT_SHIELD_DROP && detector->shieldDropMap != NULL) {
+			fprintf(fptr, "%s", detector->shieldDropMap->regions[event->detail].name);
+		}
+		fprintf(fptr, "\n");
+	}
+	
+	fclose(fptr);
+	
+	free(timeStr);
+	
 	return 0;
-}
\ No newline at end of file
+}
+
+// result of the first importStickmaps(), both menus share what it loaded
+static bool stickmapImportAttempted = false;
+static int stickmapImportResult = -1;
+
+static int readStickmapFile() {
+	if (!initFilesystem()) {
+		return -1;
+	}
+	
+	// not openFile(), this one is supposed to exist already
+	struct stat st = {0};
+	if (stat("/GTS/stickmaps.txt", &st) == -1) {
+		return -1;
+	}
+	FILE *fptr = fopen("/GTS/stickmaps.txt", "r");
+	if (fptr == NULL) {
+		return -1;
+	}
+	
+	int ret = loadStickmapDefinitions(fptr);
+	fclose(fptr);
+	return ret;
+}
+
+int importStickmaps() {
+	if (!stickmapImportAttempted) {
+		stickmapImportAttempted = true;
+		stickmapImportResult = readStickmapFile();
+	}
+	return stickmapImportResult;
+}
@@ -11,15 +11,21 @@
 #include "util/gx.h"
 
 #include <malloc.h>
+#include <stddef.h>
 #include <memory.h>
 #include <stdlib.h>
 #include <math.h>
 #include <time.h>
 
 #include <ogc/tpl.h>
+#include <ogc/cache.h>
+#include <ogc/timesupp.h>
 
 #include "util/polling.h"
 #include "util/print.h"
+#include "util/startup.h"
+#include "analysis.h"
+#include "stickmap.h"
 
 #include "textures.h"
 #include "textures_tpl.h"
@@ -34,9 +40,174 @@ GXColor GXColorAlpha(GXColor color, uint8_t alpha) {
 // default fifo size, specific number from provided gx examples
 #define DEFAULT_FIFO_SIZE (256 * 1024)
 
+// frame budget governor, see updateRenderDetail()
+// consecutive frames over RENDER_BUDGET_US before lowering detail
+#define RENDER_DETAIL_DEGRADE_FRAMES 3
+// consecutive frames under half of RENDER_BUDGET_US before raising it, roughly 2 seconds
+#define RENDER_DETAIL_RESTORE_FRAMES 120
+#define RENDER_DETAIL_RESTORE_FRAMES_MAX 1920
+
 static enum CURRENT_VTX_MODE currentVtxMode = VTX_NONE;
 static int currentTexmap = TEXMAP_NONE;
 
+// shadow copies of the rest of the gx state we touch, so that we don't send commands that wouldn't change anything
+// everything in here must only be changed through the set...() functions below, otherwise these will be wrong.
+// resetStateCache() sets these to something invalid, so that the first set always goes through
+// vertex descriptions, in order of POS, CLR0, TEX0
+enum VTX_ATTR_SLOT { VTX_ATTR_POS, VTX_ATTR_CLR0, VTX_ATTR_TEX0, VTX_ATTR_LEN };
+static const uint8_t vtxAttrSlotToAttr[VTX_ATTR_LEN] = { GX_VA_POS, GX_VA_CLR0, GX_VA_TEX0 };
+static uint8_t currentVtxAttrDesc[VTX_ATTR_LEN];
+static int currentTevOp = -1;
+static uint8_t currentLineWidth = 0;
+static uint8_t currentPointSize = 0;
+static uint32_t currentScissor[4] = { 0 };
+static int currentScissorOffsetX = 0, currentScissorOffsetY = 0;
+static bool scissorOffsetValid = false;
+static uint32_t currentMtx = GX_PNMTX0;
+// not really state, but these end up being sent every frame
+static bool viewportValid = false;
+static bool modelviewLoaded = false;
+// whether stickmapTex is loaded in TEXMAP_STICKMAPS
+static bool stickmapTexLoaded = false;
+
+// command volume for the frame in progress and the last full frame, see getGXFrameStats()
+static GXFrameStats frameStats = { 0 };
+static GXFrameStats lastFrameStats = { 0 };
+
+// returns changed, for use in an if statement
+static inline bool countStateCommand(bool changed) {
+	if (changed) {
+		frameStats.stateIssued++;
+	} else {
+		frameStats.stateElided++;
+	}
+	return changed;
+}
+
+static void setVtxAttrDesc(enum VTX_ATTR_SLOT slot, uint8_t type) {
+	if (countStateCommand(currentVtxAttrDesc[slot] != type)) {
+		GX_SetVtxDesc(vtxAttrSlotToAttr[slot], type);
+		currentVtxAttrDesc[slot] = type;
+	}
+}
+
+static void setTevOp(int tevOp) {
+	if (countStateCommand(currentTevOp != tevOp)) {
+		GX_SetTevOp(GX_TEVSTAGE0, tevOp);
+		currentTevOp = tevOp;
+	}
+}
+
+static void setScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	if (countStateCommand(currentScissor[0] != x || currentScissor[1] != y ||
+	                      currentScissor[2] != width || currentScissor[3] != height)) {
+		GX_SetScissor(x, y, width, height);
+		currentScissor[0] = x;
+		currentScissor[1] = y;
+		currentScissor[2] = width;
+		currentScissor[3] = height;
+	}
+}
+
+static void setScissorBoxOffset(int x, int y) {
+	if (countStateCommand(!scissorOffsetValid || currentScissorOffsetX != x || currentScissorOffsetY != y)) {
+		GX_SetScissorBoxOffset(x, y);
+		currentScissorOffsetX = x;
+		currentScissorOffsetY = y;
+		scissorOffsetValid = true;
+	}
+}
+
+static void setCurrentMtx(uint32_t mtx) {
+	if (countStateCommand(currentMtx != mtx)) {
+		GX_SetCurrentMtx(mtx);
+		currentMtx = mtx;
+	}
+}
+
+// for matrices that are different every time they're loaded
+static void loadPosMtx(Mtx mtx, uint32_t slot) {
+	countStateCommand(true);
+	GX_LoadPosMtxImm(mtx, slot);
+}
+
+// forget the shadow state, everything will be sent again on next use
+static void resetStateCache() {
+	currentVtxMode = VTX_NONE;
+	currentTexmap = TEXMAP_NONE;
+	for (int i = 0; i < VTX_ATTR_LEN; i++) {
+		// not a valid description type, so the next set always goes through
+		currentVtxAttrDesc[i] = 0xFF;
+	}
+	currentTevOp = -1;
+	currentLineWidth = currentPointSize = 0;
+	currentScissor[0] = currentScissor[1] = currentScissor[2] = currentScissor[3] = 0;
+	scissorOffsetValid = false;
+	currentMtx = GX_PNMTX0;
+	viewportValid = modelviewLoaded = false;
+	stickmapTexLoaded = false;
+}
+
+void getGXFrameStats(GXFrameStats *stats) {
+	*stats = lastFrameStats;
+}
+
+// frame budget governor, see updateRenderDetail()
+static enum RENDER_DETAIL renderDetail = DETAIL_FULL;
+static RenderDetailStats renderDetailStats = { 0 };
+static uint64_t drawStartTick = 0;
+// consecutive frames over budget, and under half of it
+static int framesOverBudget = 0;
+static int framesWithHeadroom = 0;
+// frames of headroom needed before raising detail again
+// this doubles if raising detail puts us right back over budget, so we don't bounce between levels
+static int restoreDelay = RENDER_DETAIL_RESTORE_FRAMES;
+// starts where it stops counting, so a degrade before the first restore doesn't look like a restore that overran
+static int framesSinceRestore = RENDER_DETAIL_RESTORE_FRAMES_MAX * 2;
+
+// called at the end of every finishDraw(), with the time since startDraw()
+static void updateRenderDetail(uint32_t drawUs) {
+	renderDetailStats.lastDrawUs = drawUs;
+	renderDetailStats.framesAtDetail[renderDetail]++;
+	// only compared against restoreDelay, no need to keep counting past that
+	if (framesSinceRestore < RENDER_DETAIL_RESTORE_FRAMES_MAX * 2) {
+		framesSinceRestore++;
+	}
+	
+	if (drawUs > RENDER_BUDGET_US) {
+		framesWithHeadroom = 0;
+		framesOverBudget++;
+		if (framesOverBudget >= RENDER_DETAIL_DEGRADE_FRAMES && renderDetail != DETAIL_MINIMAL) {
+			renderDetail++;
+			renderDetailStats.degradeCount++;
+			framesOverBudget = 0;
+			if (framesSinceRestore < restoreDelay * 2 && restoreDelay < RENDER_DETAIL_RESTORE_FRAMES_MAX) {
+				restoreDelay *= 2;
+			}
+		}
+	} else {
+		framesOverBudget = 0;
+		if (drawUs < RENDER_BUDGET_US / 2) {
+			framesWithHeadroom++;
+			if (framesWithHeadroom >= restoreDelay && renderDetail != DETAIL_FULL) {
+				renderDetail--;
+				framesWithHeadroom = 0;
+				framesSinceRestore = 0;
+			}
+		} else {
+			framesWithHeadroom = 0;
+		}
+	}
+}
+
+enum RENDER_DETAIL getRenderDetail() {
+	return renderDetail;
+}
+
+void getRenderDetailStats(RenderDetailStats *stats) {
+	*stats = renderDetailStats;
+}
+
 // address of memory allocated for fifo
 static void *gp_fifo = nullptr;
 
@@ -45,6 +216,34 @@ static void *gp_fifo = nullptr;
 // (basically for debugging)
 //static GXFifoObj *gxFifoObj = nullptr;
 
+#ifdef BENCH
+// the cpu and gp share one fifo, so whatever is in it is what the gp hasn't gotten to yet
+// this isn't free, so it's only done for BENCH builds
+static void sampleFifoUsage() {
+	GXFifoObj cpuFifo;
+	GX_GetCPUFifo(&cpuFifo);
+	uint32_t used = GX_GetFifoCount(&cpuFifo);
+	if (used > frameStats.fifoHighWater) {
+		frameStats.fifoHighWater = used;
+	}
+}
+#endif
+
+void beginPrimitive(uint8_t primitive, uint8_t vtxFmt, uint16_t vertexCount) {
+	frameStats.batches++;
+	frameStats.vertices += vertexCount;
+	#ifdef BENCH
+	sampleFifoUsage();
+	#endif
+	GX_Begin(primitive, vtxFmt, vertexCount);
+}
+
+void callDisplayList(void *list, uint32_t size) {
+	flushPrimitiveBatch();
+	frameStats.displayLists++;
+	GX_CallDispList(list, size);
+}
+
 // rmode pointer
 // passed in setupGX()
 static GXRModeObj *rmodePtr = NULL;
@@ -58,9 +257,33 @@ static TPLFile tpl;
 static GXTexObj fontTex;
 static GXTexObj fontButtonTex;
 static GXTexObj controllerTex;
-static GXTexObj stickmapTexArr[6];
+static GXTexObj stickmapTex;
 static GXTexObj stickOutlineTex;
 static GXTexObj pTex;
+static GXTexObj heatmapTex;
+
+// counts are converted to an I8 texture, which is stored in 8x4 texel tiles of 32 bytes
+// only tiles with new counts are converted and flushed from cache
+#define HEATMAP_TILE_WIDTH 8
+#define HEATMAP_TILE_HEIGHT 4
+#define HEATMAP_TILES_PER_ROW (HEATMAP_SIZE / HEATMAP_TILE_WIDTH)
+#define HEATMAP_TILE_COUNT (HEATMAP_TILES_PER_ROW * (HEATMAP_SIZE / HEATMAP_TILE_HEIGHT))
+
+static uint16_t heatmapCounts[HEATMAP_SIZE][HEATMAP_SIZE];
+static uint8_t heatmapTexels[HEATMAP_SIZE * HEATMAP_SIZE] ATTRIBUTE_ALIGN(32);
+// one bit per tile
+static uint32_t heatmapDirtyTiles[HEATMAP_TILE_COUNT / 32];
+
+// raw stickmaps are drawn into an RGB5A3 texture, one texel per stick coordinate like the heatmap
+// RGB5A3 is stored in 4x4 texel tiles of 32 bytes
+#define STICKMAP_TEX_SIZE 256
+#define STICKMAP_TEX_TILE_SIZE 4
+#define STICKMAP_TEX_TILES_PER_ROW (STICKMAP_TEX_SIZE / STICKMAP_TEX_TILE_SIZE)
+
+static uint16_t stickmapTexels[STICKMAP_TEX_SIZE * STICKMAP_TEX_SIZE] ATTRIBUTE_ALIGN(32);
+// what's in stickmapTexels, the revision changes if the stickmap is read again
+static const Stickmap *currentStickmap = NULL;
+static uint32_t currentStickmapRevision = 0;
 
 // keeps track of our current z depth, for drawing helper functions
 // TODO: z depth for specific elements (font, quads, lines, etc) need to be standardized
@@ -77,38 +300,107 @@ static uint8_t prevAlphaValue = GX_DEFAULT_ALPHA;
 static bool resetAlphaAfter = false;
 static bool lockResetAlpha = false;
 
+// primitive batching
+// drawLine(), drawBox(), drawSolidBox(), and drawTri() don't draw immediately, they add vertices to this batch.
+// the batch is sent in one GX_Begin() when a different primitive type is added, when any other drawing or
+// state change happens, or in finishDraw().
+// depth and color (with alpha) are stored per vertex, so those can change freely between calls.
+// 1200 so that it divides evenly for lines, tris, and quads
+#define PRIMITIVE_BATCH_MAX_VERTICES 1200
+
+typedef struct BatchVertex {
+	int16_t x, y, z;
+	GXColor color;
+} BatchVertex;
+
+static BatchVertex batchVertices[PRIMITIVE_BATCH_MAX_VERTICES];
+static int batchVertexCount = 0;
+// GX_LINES, GX_TRIANGLES, or GX_QUADS
+static uint8_t batchPrimitive = GX_LINES;
+
+static void setVtxDesc(enum CURRENT_VTX_MODE mode, int tevOp);
+
+void flushPrimitiveBatch() {
+	if (batchVertexCount == 0) {
+		return;
+	}
+	
+	setVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
+	
+	beginPrimitive(batchPrimitive, VTXFMT_PRIMITIVES_INT, batchVertexCount);
+	for (int i = 0; i < batchVertexCount; i++) {
+		GX_Position3s16(batchVertices[i].x, batchVertices[i].y, batchVertices[i].z);
+		GX_Color4u8(batchVertices[i].color.r, batchVertices[i].color.g, batchVertices[i].color.b,
+		            batchVertices[i].color.a);
+	}
+	GX_End();
+	
+	batchVertexCount = 0;
+}
+
+// make sure there's room for count vertices of the given primitive type
+static BatchVertex* reserveBatchVertices(uint8_t primitive, int count) {
+	if (batchPrimitive != primitive || batchVertexCount + count > PRIMITIVE_BATCH_MAX_VERTICES) {
+		flushPrimitiveBatch();
+		batchPrimitive = primitive;
+	}
+	BatchVertex *ret = &batchVertices[batchVertexCount];
+	batchVertexCount += count;
+	return ret;
+}
+
+static inline void setBatchVertex(BatchVertex *vtx, int x, int y, GXColor color) {
+	vtx->x = x;
+	vtx->y = y;
+	vtx->z = zDepth;
+	vtx->color = (GXColor) { color.r, color.g, color.b, alphaValue };
+}
+
 // change vertex descriptions to one of the above, specifying the tev combiner op if necessary
 void updateVtxDesc(enum CURRENT_VTX_MODE mode, int tevOp) {
+	// anything that changes the vertex description is about to draw, so the batch needs to go first
+	flushPrimitiveBatch();
+	setVtxDesc(mode, tevOp);
+}
+
+static void setVtxDesc(enum CURRENT_VTX_MODE mode, int tevOp) {
 	// only run if we are drawing something different
-	if (mode != currentVtxMode) {
-		// we always provide direct data for position
-		// probably not needed...
-		GX_SetVtxDesc(GX_VA_POS, GX_DIRECT);
-		
-		switch (mode) {
-			case VTX_PRIMITIVES:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_DISABLE);
-				GX_SetTevOp(GX_TEVSTAGE0, tevOp);
-				break;
-			case VTX_TEXTURES:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
-				GX_SetTevOp(GX_TEVSTAGE0, tevOp);
-				break;
-			case VTX_NONE:
-			default:
-				// error case?
-				break;
-		}
-		
-		GX_SetTevDirect(GX_TEVSTAGE0);
-		currentVtxMode = mode;
+	if (!countStateCommand(mode != currentVtxMode)) {
+		return;
+	}
+	
+	switch (mode) {
+		case VTX_PRIMITIVES:
+			setVtxAttrDesc(VTX_ATTR_POS, GX_DIRECT);
+			setVtxAttrDesc(VTX_ATTR_CLR0, GX_DIRECT);
+			setVtxAttrDesc(VTX_ATTR_TEX0, GX_DISABLE);
+			break;
+		case VTX_TEXTURES:
+			setVtxAttrDesc(VTX_ATTR_POS, GX_DIRECT);
+			setVtxAttrDesc(VTX_ATTR_CLR0, GX_DIRECT);
+			setVtxAttrDesc(VTX_ATTR_TEX0, GX_DIRECT);
+			break;
+		case VTX_INDEXED:
+			// 16 bit indices for both, arrays are set by whatever is drawing
+			setVtxAttrDesc(VTX_ATTR_POS, GX_INDEX16);
+			setVtxAttrDesc(VTX_ATTR_CLR0, GX_INDEX16);
+			setVtxAttrDesc(VTX_ATTR_TEX0, GX_DISABLE);
+			break;
+		case VTX_NONE:
+		default:
+			// error case?
+			break;
 	}
+	setTevOp(tevOp);
+	
+	GX_SetTevDirect(GX_TEVSTAGE0);
+	currentVtxMode = mode;
 }
 
 // change the texture used for tev op
 // (this changes what texture will be drawn on a primitive)
 void changeLoadedTexmap(int newTexmap) {
-	if (currentTexmap != newTexmap) {
+	if (countStateCommand(currentTexmap != newTexmap)) {
 		if (newTexmap == TEXMAP_NONE) {
 			GX_SetTevOrder(GX_TEVSTAGE0, GX_TEXCOORDNULL, GX_TEXMAP_NULL, GX_COLOR0A0);
 		} else {
@@ -137,8 +429,10 @@ void getCurrentTexmapDims(int *width, int *height) {
 			selection = &fontButtonTex;
 			break;
 		case TEXMAP_STICKMAPS:
-			// all of these are the same, so any will do
-			selection = &(stickmapTexArr[0]);
+			selection = &stickmapTex;
+			break;
+		case TEXMAP_HEATMAP:
+			selection = &heatmapTex;
 			break;
 		case TEXMAP_NONE:
 		default:
@@ -151,11 +445,61 @@ void getCurrentTexmapDims(int *width, int *height) {
 	}
 }
 
-// expects enum IMAGE as defined in plot2d.h
-void changeStickmapTexture(int image) {
-	if (image > 0 && image < 7) {
-		// texmap array doesn't hold a "no image" texture, so we have to shift index by one from the provided enum
-		GX_LoadTexObj(&(stickmapTexArr[image - 1]), TEXMAP_STICKMAPS);
+// draw every region's bitmaps into stickmapTexels, anything outside a region is transparent
+static void buildStickmapTexels(const Stickmap *stickmap) {
+	memset(stickmapTexels, 0, sizeof(stickmapTexels));
+	for (int i = 1; i < stickmap->regionCount; i++) {
+		const StickmapRegion *region = &(stickmap->regions[i]);
+		// top bit set is opaque RGB555
+		uint16_t texel = 0x8000 | ((region->color[0] >> 3) << 10) | ((region->color[1] >> 3) << 5) |
+		                 (region->color[2] >> 3);
+		for (int quadrant = 0; quadrant < 4; quadrant++) {
+			const uint32_t *bitmap = getStickmapQuadrant(stickmap, region, quadrant);
+			if (bitmap == NULL) {
+				continue;
+			}
+			for (int word = 0; word < STICKMAP_RAW_GRID_WORDS; word++) {
+				uint32_t bits = bitmap[word];
+				while (bits != 0) {
+					int bit = __builtin_ctz(bits);
+					bits &= bits - 1;
+					
+					int cell = (word * 32) + bit;
+					// same orientation as the heatmap, there's no row for y = -128
+					int col = STICKMAP_CELL_X(STICKMAP_RAW_GRID_SIZE, quadrant, cell) + 128;
+					int row = 128 - STICKMAP_CELL_Y(STICKMAP_RAW_GRID_SIZE, quadrant, cell);
+					if (row > STICKMAP_TEX_SIZE - 1) {
+						continue;
+					}
+					int tile = (row / STICKMAP_TEX_TILE_SIZE) * STICKMAP_TEX_TILES_PER_ROW +
+					           (col / STICKMAP_TEX_TILE_SIZE);
+					stickmapTexels[(tile * STICKMAP_TEX_TILE_SIZE * STICKMAP_TEX_TILE_SIZE) +
+					               ((row % STICKMAP_TEX_TILE_SIZE) * STICKMAP_TEX_TILE_SIZE) +
+					               (col % STICKMAP_TEX_TILE_SIZE)] = texel;
+				}
+			}
+		}
+	}
+	DCFlushRange(stickmapTexels, sizeof(stickmapTexels));
+}
+
+void changeStickmapTexture(const Stickmap *stickmap) {
+	if (stickmap == NULL || stickmap->units != STICKMAP_UNITS_RAW) {
+		return;
+	}
+	
+	if (stickmap != currentStickmap || stickmap->revision != currentStickmapRevision) {
+		buildStickmapTexels(stickmap);
+		currentStickmap = stickmap;
+		currentStickmapRevision = stickmap->revision;
+		// gp might still have the old texels in its texture cache
+		flushPrimitiveBatch();
+		GX_InvalidateTexAll();
+	}
+	
+	if (countStateCommand(!stickmapTexLoaded)) {
+		GX_LoadTexObj(&stickmapTex, TEXMAP_STICKMAPS);
+		stickmapTexLoaded = true;
 	}
 }
 
@@ -174,6 +518,9 @@ void setupGX(GXRModeObj *rmode) {
 	// set this for future use, so we don't have to continue to pass it
 	rmodePtr = rmode;
 	
+	// nothing has been sent yet
+	resetStateCache();
+	
 	// setup gx to clear background on each new frame
 	GXColor background = {0,0,0,0xff};
 	//GXColor background = {0xff, 0xff, 0xff, 0xff};
@@ -183,7 +530,7 @@ void setupGX(GXRModeObj *rmode) {
 	GX_SetViewport(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight,0,1);
 	float yscale = GX_GetYScaleFactor(rmodePtr->efbHeight, rmodePtr->xfbHeight);
 	uint32_t xfbHeight = GX_SetDispCopyYScale(yscale);
-	GX_SetScissor(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight);
+	setScissor(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight);
 	GX_SetDispCopySrc(0,0,rmodePtr->fbWidth,rmodePtr->efbHeight);
 	GX_SetDispCopyDst(rmodePtr->fbWidth, xfbHeight);
 	GX_SetPixelFmt(GX_PF_RGB8_Z24, GX_ZC_LINEAR);
@@ -202,6 +549,9 @@ void setupGX(GXRModeObj *rmode) {
 	GX_SetVtxDesc(GX_VA_CLR0, GX_DIRECT);
 	GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
 
+	// vertex descriptions are in a known state from here on
+	currentVtxAttrDesc[VTX_ATTR_POS] = currentVtxAttrDesc[VTX_ATTR_CLR0] = currentVtxAttrDesc[VTX_ATTR_TEX0] = GX_DIRECT;
+	
 	// VTXFMT0, configured for primitive drawing, integer screenspace coordinates
 	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_INT, GX_VA_POS, GX_POS_XYZ, GX_S16, 0);
 	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_INT, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
@@ -210,13 +560,25 @@ void setupGX(GXRModeObj *rmode) {
 	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_FLOAT, GX_VA_POS, GX_POS_XYZ, GX_F32, 0);
 	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_FLOAT, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
 	
+	// VTXFMT5, configured for primitive drawing, fixed point screenspace coordinates
+	// half the size of float coordinates, without losing sub-unit precision
+	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_FIXED, GX_VA_POS, GX_POS_XYZ, GX_S16, VTXFMT_FIXED_FRAC_BITS);
+	GX_SetVtxAttrFmt(VTXFMT_PRIMITIVES_FIXED, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
+	
 	// VTXFMT2, configured for textures
 	GX_SetVtxAttrFmt(VTXFMT_TEXTURES, GX_VA_POS, GX_POS_XYZ, GX_S16, 0);
 	GX_SetVtxAttrFmt(VTXFMT_TEXTURES, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
 	GX_SetVtxAttrFmt(VTXFMT_TEXTURES, GX_VA_TEX0, GX_TEX_ST, GX_S16, 0);
-
 	
-	currentVtxMode = VTX_NONE;
+	// VTXFMT3, indexed graph vertices, xy pairs of (sample index, value)
+	// actual screen position comes from the matrix loaded in drawGraph()
+	GX_SetVtxAttrFmt(VTXFMT_INDEXED_GRAPH, GX_VA_POS, GX_POS_XY, GX_S16, 0);
+	GX_SetVtxAttrFmt(VTXFMT_INDEXED_GRAPH, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
+	
+	// VTXFMT4, indexed stick positions, read directly from ControllerSample
+	GX_SetVtxAttrFmt(VTXFMT_INDEXED_POINTS, GX_VA_POS, GX_POS_XY, GX_S8, 0);
+	GX_SetVtxAttrFmt(VTXFMT_INDEXED_POINTS, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
+
 	
 	// TODO: this is where my understanding of the code goes completely out the window,
 	// TODO: there's probably multiple things wrong here, even more than above...
@@ -230,7 +592,7 @@ void setupGX(GXRModeObj *rmode) {
 	//GX_SetNumTevStages(2);
 	GX_SetNumTevStages(1);
 	GX_SetTevOrder(GX_TEVSTAGE0, GX_TEXCOORDNULL, GX_TEXMAP_NULL, GX_COLOR0A0);
-	GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
+	setTevOp(GX_PASSCLR);
 	GX_SetTevDirect(GX_TEVSTAGE0);
 	
 	// TODO: is there a way to have this apply only to certain vertex descriptions?
@@ -253,18 +615,6 @@ void setupGX(GXRModeObj *rmode) {
 	TPL_GetTexture(&tpl, controller, &controllerTex);
 	GX_LoadTexObj(&controllerTex, TEXMAP_CONTROLLER);
 	
-	// all the stickmaps
-	// we don't actually load all the stickmaps into the texmap slots, there aren't enough
-	// we'll switch what stickmap is in the texmap slot on when its needed
-	TPL_GetTexture(&tpl, deadzone, &stickmapTexArr[0]);
-	TPL_GetTexture(&tpl, await, &stickmapTexArr[1]);
-	TPL_GetTexture(&tpl, movewait, &stickmapTexArr[2]);
-	TPL_GetTexture(&tpl, crouch, &stickmapTexArr[3]);
-	TPL_GetTexture(&tpl, ledgel, &stickmapTexArr[4]);
-	TPL_GetTexture(&tpl, ledger, &stickmapTexArr[5]);
-	// load first one by default, because why not?
-	GX_LoadTexObj(&(stickmapTexArr[0]), TEXMAP_STICKMAPS);
-	
 	// stick outline for coordinate viewer
 	TPL_GetTexture(&tpl, outline, &stickOutlineTex);
 	GX_LoadTexObj(&stickOutlineTex, TEXMAP_STICKOUTLINE);
@@ -275,7 +625,23 @@ void setupGX(GXRModeObj *rmode) {
 	TPL_GetTexture(&tpl, p, &pTex);
 	GX_LoadTexObj(&pTex, TEXMAP_P);
 	
+	// heatmap texture is generated, see drawHeatmap()
+	DCFlushRange(heatmapTexels, sizeof(heatmapTexels));
+	GX_InitTexObj(&heatmapTex, heatmapTexels, HEATMAP_SIZE, HEATMAP_SIZE, GX_TF_I8, GX_CLAMP, GX_CLAMP, GX_FALSE);
+	// each texel is one stick coordinate, so don't blur them together
+	GX_InitTexObjFilterMode(&heatmapTex, GX_NEAR, GX_NEAR);
+	GX_LoadTexObj(&heatmapTex, TEXMAP_HEATMAP);
+	
+	// same for the 2d plot's stickmaps, see changeStickmapTexture()
+	DCFlushRange(stickmapTexels, sizeof(stickmapTexels));
+	GX_InitTexObj(&stickmapTex, stickmapTexels, STICKMAP_TEX_SIZE, STICKMAP_TEX_SIZE, GX_TF_RGB5A3,
+	              GX_CLAMP, GX_CLAMP, GX_FALSE);
+	GX_InitTexObjFilterMode(&stickmapTex, GX_NEAR, GX_NEAR);
+	GX_LoadTexObj(&stickmapTex, TEXMAP_STICKMAPS);
+	stickmapTexLoaded = true;
+	
 	TPL_CloseTPLFile(&tpl);
+	markStartupPhase(STARTUP_TEXTURES);
 	
 	GX_SetBlendMode(GX_BM_BLEND, GX_BL_SRCALPHA, GX_BL_INVSRCALPHA, GX_LO_CLEAR);
 	
@@ -302,14 +668,17 @@ void setupGX(GXRModeObj *rmode) {
 void setSubwindowScissorBox(int x1, int y1, int x2, int y2) {
 	setDepthForDrawCall(3);
 	drawBox(x1, y1, x2, y2, GX_COLOR_WHITE);
-	GX_SetScissor(0, 0, x2 - x1, y2 - y1);
-	GX_SetScissorBoxOffset(-1 * x1, -1 * y1);
+	// box needs to be drawn with the normal scissor
+	flushPrimitiveBatch();
+	setScissor(0, 0, x2 - x1, y2 - y1);
+	setScissorBoxOffset(-1 * x1, -1 * y1);
 }
 
 // return scissor box to normal, mainly used after setSubwindowScissorBox()
 void restoreNormalScissorBox() {
-	GX_SetScissor(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight);
-	GX_SetScissorBoxOffset(0, 0);
+	flushPrimitiveBatch();
+	setScissor(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight);
+	setScissorBoxOffset(0, 0);
 }
 
 /*
@@ -320,30 +689,80 @@ uint8_t getFifoVal() {
 
 // start and end of draw
 void startDraw() {
-	GX_SetViewport(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight, 0, 1);
+	drawStartTick = gettime();
 	
-	guMtxIdentity(model);
-	guMtxTransApply(model, model, 0.0f, 0.0f, -1.0f);
-	guMtxConcat(view,model,modelview);
+	// these never change after the first frame
+	if (countStateCommand(!viewportValid)) {
+		GX_SetViewport(0, 0, rmodePtr->fbWidth, rmodePtr->efbHeight, 0, 1);
+		viewportValid = true;
+	}
+	if (countStateCommand(!modelviewLoaded)) {
+		guMtxIdentity(model);
+		guMtxTransApply(model, model, 0.0f, 0.0f, -1.0f);
+		guMtxConcat(view,model,modelview);
 	
-	GX_LoadPosMtxImm(modelview, GX_PNMTX0);
+		GX_LoadPosMtxImm(modelview, GX_PNMTX0);
+		modelviewLoaded = true;
+	}
+	setCurrentMtx(GX_PNMTX0);
 	
-	GX_SetLineWidth(12, GX_TO_ZERO);
-	GX_SetPointSize(12, GX_TO_ZERO);
+	setLineWidth(12);
+	setPointSize(12);
 	resetDepth();
 }
 
+static late_latch_draw lateLatchDraw = NULL;
+static int lateLatchZDepth = GX_DEFAULT_Z_DEPTH;
+static uint8_t lateLatchAlpha = GX_DEFAULT_ALPHA;
+
+void setLateLatchDraw(late_latch_draw draw) {
+	lateLatchDraw = draw;
+	lateLatchZDepth = zDepth;
+	lateLatchAlpha = alphaValue;
+}
+
+// read the controller as late as possible, and run the draw with it
+static void runLateLatchDraw() {
+	PADStatus status;
+	readLatestControllerStatus(&status);
+	
+	int prevZDepth = zDepth;
+	uint8_t prevAlpha = alphaValue;
+	zDepth = lateLatchZDepth;
+	alphaValue = lateLatchAlpha;
+	
+	lateLatchDraw(&status);
+	
+	zDepth = prevZDepth;
+	alphaValue = prevAlpha;
+	lateLatchDraw = NULL;
+}
+
 static int offsetX = 0, offsetY = 0;
 void finishDraw(void *xfb) {
-	GX_SetScissorBoxOffset(offsetX, offsetY);
+	if (lateLatchDraw != NULL) {
+		runLateLatchDraw();
+	}
+	flushPrimitiveBatch();
+	
+	setScissorBoxOffset(offsetX, offsetY);
 	
 	// I'm not entirely sure as to why this order is correct
 	// drawdone() will call gx_flush(), which should be before copydisp() (extrems' discord)
 	// but i feel like this is counterintuitive, shouldn't the efb draw be done _before_ copying? or does copydisp()
 	// add a command to the gp list that is executed at the end? i wish i understood this better...
 	GX_CopyDisp(xfb, GX_TRUE);
+	#ifdef BENCH
+	sampleFifoUsage();
+	#endif
 	GX_DrawDone();
 	
+	updateRenderDetail(ticks_to_microsecs(gettime() - drawStartTick));
+	
+	// frame is done, keep its counts around
+	lastFrameStats = frameStats;
+	frameStats = (GXFrameStats) { 0 };
+	
 	//GX_SetAlphaUpdate(GX_TRUE);
 	//GX_SetColorUpdate(GX_TRUE);
 }
@@ -411,19 +830,8 @@ void resetAlpha() {
 	lockResetAlpha = resetAlphaAfter = false;
 }
 
-void drawLine(int x1, int y1, int x2, int y2, GXColor color) {
-	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-	
-	GX_Begin(GX_LINES, VTXFMT_PRIMITIVES_INT, 2);
-	
-	GX_Position3s16(x1, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x2, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_End();
-	
+// helper for the reset checks done at the end of every draw function
+static void finishDrawCall() {
 	if (resetZDepthAfter) {
 		restorePrevDepthFromDrawCall();
 	}
@@ -432,84 +840,64 @@ void drawLine(int x1, int y1, int x2, int y2, GXColor color) {
 	}
 }
 
-void drawBox(int x1, int y1, int x2, int y2, GXColor color) {
-	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-	
-	GX_Begin(GX_LINESTRIP, VTXFMT_PRIMITIVES_INT, 5);
-	
-	GX_Position3s16(x1, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x2, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
+void drawLine(int x1, int y1, int x2, int y2, GXColor color) {
+	BatchVertex *vtx = reserveBatchVertices(GX_LINES, 2);
+	setBatchVertex(&vtx[0], x1, y1, color);
+	setBatchVertex(&vtx[1], x2, y2, color);
 	
-	GX_Position3s16(x2, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
+	finishDrawCall();
+}
+
+void drawBox(int x1, int y1, int x2, int y2, GXColor color) {
+	// four separate lines instead of a line strip, so that this can share a batch with drawLine()
+	BatchVertex *vtx = reserveBatchVertices(GX_LINES, 8);
+	setBatchVertex(&vtx[0], x1, y1, color);
+	setBatchVertex(&vtx[1], x2, y1, color);
 	
-	GX_Position3s16(x1, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
+	setBatchVertex(&vtx[2], x2, y1, color);
+	setBatchVertex(&vtx[3], x2, y2, color);
 	
-	GX_Position3s16(x1, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
+	setBatchVertex(&vtx[4], x2, y2, color);
+	setBatchVertex(&vtx[5], x1, y2, color);
 	
-	GX_End();
+	setBatchVertex(&vtx[6], x1, y2, color);
+	setBatchVertex(&vtx[7], x1, y1, color);
 	
-	if (resetZDepthAfter) {
-		restorePrevDepthFromDrawCall();
-	}
-	if (resetAlphaAfter) {
-		restorePrevAlphaFromDrawCall();
-	}
+	finishDrawCall();
 }
 
 void drawSolidBox(int x1, int y1, int x2, int y2, GXColor color) {
-	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
+	BatchVertex *vtx = reserveBatchVertices(GX_QUADS, 4);
+	setBatchVertex(&vtx[0], x1, y1, color);
+	setBatchVertex(&vtx[1], x2, y1, color);
+	setBatchVertex(&vtx[2], x2, y2, color);
+	setBatchVertex(&vtx[3], x1, y2, color);
 	
-	GX_Begin(GX_QUADS, VTXFMT_PRIMITIVES_INT, 4);
-	
-	GX_Position3s16(x1, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x2, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x2, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x1, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_End();
-	
-	if (resetZDepthAfter) {
-		restorePrevDepthFromDrawCall();
-	}
-	if (resetAlphaAfter) {
-		restorePrevAlphaFromDrawCall();
-	}
+	finishDrawCall();
 }
 
 void drawTri(int x1, int y1, int x2, int y2, int x3, int y3, GXColor color) {
-	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-	
-	GX_Begin(GX_TRIANGLES, VTXFMT_PRIMITIVES_INT, 3);
-	
-	GX_Position3s16(x1, y1, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
+	BatchVertex *vtx = reserveBatchVertices(GX_TRIANGLES, 3);
+	setBatchVertex(&vtx[0], x1, y1, color);
+	setBatchVertex(&vtx[1], x2, y2, color);
+	setBatchVertex(&vtx[2], x3, y3, color);
 	
-	GX_Position3s16(x2, y2, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_Position3s16(x3, y3, zDepth);
-	GX_Color4u8(color.r, color.g, color.b, alphaValue);
-	
-	GX_End();
-	
-	if (resetZDepthAfter) {
-		restorePrevDepthFromDrawCall();
+	finishDrawCall();
+}
+
+void setLineWidth(uint8_t width) {
+	if (countStateCommand(currentLineWidth != width)) {
+		flushPrimitiveBatch();
+		GX_SetLineWidth(width, GX_TO_ZERO);
+		currentLineWidth = width;
 	}
-	if (resetAlphaAfter) {
-		restorePrevAlphaFromDrawCall();
+}
+
+void setPointSize(uint8_t size) {
+	if (countStateCommand(currentPointSize != size)) {
+		flushPrimitiveBatch();
+		GX_SetPointSize(size, GX_TO_ZERO);
+		currentPointSize = size;
 	}
 }
 
@@ -524,12 +912,34 @@ static int graphMaxVisibleDatapoints = -1;
 // mainly used for continuous oscilloscope
 static int graphZeroIndexOffset = 0;
 
+// vertex arrays for drawing static recordings
+// positions are (sample index, value) pairs, and each vertex has its own color entry,
+// so that a given vertex can use the same index for both
+// only rebuilt when the recording (or how we look at it) changes, see updateGraphVertexArrays()
+static int16_t graphPositionArr[2][REC_SAMPLE_MAX][2] ATTRIBUTE_ALIGN(32);
+static GXColor graphColorArr[2][REC_SAMPLE_MAX] ATTRIBUTE_ALIGN(32);
+static const ControllerRec *graphArrData = NULL;
+static uint32_t graphArrRevision = 0;
+static enum GRAPH_TYPE graphArrType = GRAPH_STICK;
+static enum CONTROLLER_STICK_AXIS graphArrAxis = AXIS_AXY;
+static int graphArrZeroIndexOffset = 0;
+static int graphArrSampleEnd = 0;
+
+// game read overlay, see setDrawGraphGameReads()
+static bool graphGameReadsEnabled = false;
+static uint32_t graphGameReadsPhaseUs = 0;
+// see setDrawGraphMarkers()
+static const GraphMarker *graphMarkers = NULL;
+static int graphMarkerCount = 0;
+
 // should be called in a setup() function
 void resetDrawGraph() {
 	graphScrollOffset = 0;
 	graphVisibleDatapoints = -1;
 	graphMaxVisibleDatapoints = -1;
 	graphZeroIndexOffset = 0;
+	graphGameReadsEnabled = false;
+	graphMarkerCount = 0;
 }
 
 // for everything other than GRAPH_TRIGGER
@@ -543,6 +953,16 @@ void setDrawGraphIndexOffset(int offset) {
 	graphZeroIndexOffset = offset;
 }
 
+void setDrawGraphGameReads(bool enabled, uint32_t phaseUs) {
+	graphGameReadsEnabled = enabled;
+	graphGameReadsPhaseUs = phaseUs;
+}
+
+void setDrawGraphMarkers(const GraphMarker *markers, int count) {
+	graphMarkers = markers;
+	graphMarkerCount = (count > GRAPH_MARKER_MAX) ? GRAPH_MARKER_MAX : count;
+}
+
 // stat values that menus retrieve
 static uint64_t graphTimeUsecs = 0;
 static bool yMagnitudeIsGreater = false;
@@ -563,9 +983,455 @@ void getGraphDisplayedInfo(int *scrollOffset, int *visibleSamples) {
 	*visibleSamples = graphVisibleDatapoints;
 }
 
+// drawGraph() is split into small kernels, so that the per-sample loops don't need to check the graph type,
+// the axis, or which line is being drawn. each graph type calls the kernels with constant arguments,
+// which lets the compiler build a specialized loop for each of them.
+
+// a range of samples that can be read without wrapping around the continuous ring buffer
+typedef struct GraphRun {
+	// first sample index
+	int dataStart;
+	// visible index of the first sample
+	int drawStart;
+	// samples with data
+	int count;
+	// samples after that without data, these are drawn as a gray line at zero
+	int blankCount;
+} GraphRun;
+
+// split the visible range into runs, returns the number of runs (1 or 2)
+// GRAPH_STICK_FULL is the only type that can wrap
+static int getGraphRuns(ControllerRec *data, enum GRAPH_TYPE type, int start, int count, GraphRun runs[2]) {
+	int runCount = 1;
+	runs[0].dataStart = start;
+	runs[0].drawStart = 0;
+	runs[0].count = count;
+	
+	if (type == GRAPH_STICK_FULL) {
+		runs[0].dataStart = (start + graphZeroIndexOffset) % graphMaxVisibleDatapoints;
+		if (runs[0].dataStart + count > graphMaxVisibleDatapoints) {
+			runs[0].count = graphMaxVisibleDatapoints - runs[0].dataStart;
+			runs[1].dataStart = 0;
+			runs[1].drawStart = runs[0].count;
+			runs[1].count = count - runs[0].count;
+			runCount = 2;
+		}
+	}
+	
+	for (int i = 0; i < runCount; i++) {
+		runs[i].blankCount = 0;
+		// trigger graphs always draw whatever is in the array
+		if (type != GRAPH_TRIGGER) {
+			int available = data->sampleEnd - runs[i].dataStart;
+			if (available < 0) {
+				available = 0;
+			}
+			if (available < runs[i].count) {
+				runs[i].blankCount = runs[i].count - available;
+				runs[i].count = available;
+			}
+		}
+	}
+	
+	return runCount;
+}
+
+// pick what values each line reads, as a byte offset into ControllerSample
+static void getGraphLineOffsets(ControllerRec *data, enum GRAPH_TYPE type, size_t offsets[2]) {
+	if (type == GRAPH_TRIGGER) {
+		offsets[0] = offsets[1] = (data->recordingType == REC_TRIGGER_L) ?
+		                          offsetof(ControllerSample, triggerL) : offsetof(ControllerSample, triggerR);
+	} else if (drawnAxis == AXIS_CXY) {
+		offsets[0] = offsetof(ControllerSample, cStickX);
+		offsets[1] = offsetof(ControllerSample, cStickY);
+	} else {
+		offsets[0] = offsetof(ControllerSample, stickX);
+		offsets[1] = offsetof(ControllerSample, stickY);
+	}
+}
+
+// stick values are signed, trigger values aren't
+static inline int getGraphSampleValue(const ControllerSample *sample, const size_t offset, const bool isSigned) {
+	const uint8_t *value = ((const uint8_t *) sample) + offset;
+	return isSigned ? *((const int8_t *) value) : *value;
+}
+
+// distance between samples on screen, in 16.16 fixed point
+static inline int32_t getGraphSampleStep() {
+	return (int32_t) ((WAVEFORM_DISPLAY_WIDTH * 65536) / (graphVisibleDatapoints - 1));
+}
+
+// screen x position of a given visible index, in whole units
+static inline int getGraphSampleXPos(int drawIndex, int32_t sampleStep) {
+	return SCREEN_TIMEPLOT_START + ((drawIndex * sampleStep) >> 16);
+}
+
+// how many samples each drawn vertex covers, a power of 2
+// lower render detail skips samples, but only while there are still at least as many vertices as pixels,
+// so zoomed in graphs are always drawn in full
+static int getGraphDecimation() {
+	int decimation = 1 << getRenderDetail();
+	while (decimation > 1 && graphVisibleDatapoints / decimation < (int) WAVEFORM_DISPLAY_WIDTH) {
+		decimation >>= 1;
+	}
+	return decimation;
+}
+
+// vertices in a graph line with the given decimation
+// every visible index that's a multiple of decimation is drawn
+static inline int getGraphVertexCount(int decimation) {
+	return (graphVisibleDatapoints + decimation - 1) / decimation;
+}
+
+// immediate mode vertices for a single run
+// positions are sent as s16 with VTXFMT_FIXED_FRAC_BITS fractional bits, see VTXFMT_PRIMITIVES_FIXED
+static inline void emitGraphRun(const ControllerSample *samples, const GraphRun *run, const size_t offset,
+                                const bool isSigned, int32_t sampleStep, int decimation, int yPosModifier, int z,
+                                GXColor color) {
+	const ControllerSample *sample = &samples[run->dataStart];
+	const int16_t xStart = SCREEN_TIMEPLOT_START * VTXFMT_FIXED_ONE;
+	const int16_t yFixed = yPosModifier * VTXFMT_FIXED_ONE;
+	const int16_t zFixed = z * VTXFMT_FIXED_ONE;
+	const int32_t xStep = sampleStep * decimation;
+	// first index in this run that lands on the decimation grid
+	int i = (-run->drawStart) & (decimation - 1);
+	// 16.16 offset from the start of the graph
+	int32_t xOffset = (run->drawStart + i) * sampleStep;
+	for (; i < run->count; i += decimation) {
+		GX_Position3s16(xStart + (xOffset >> (16 - VTXFMT_FIXED_FRAC_BITS)),
+		                yFixed - (getGraphSampleValue(&sample[i], offset, isSigned) * VTXFMT_FIXED_ONE), zFixed);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+		xOffset += xStep;
+	}
+	for (; i < run->count + run->blankCount; i += decimation) {
+		GX_Position3s16(xStart + (xOffset >> (16 - VTXFMT_FIXED_FRAC_BITS)), yFixed, zFixed);
+		GX_Color4u8(GX_COLOR_GRAY.r, GX_COLOR_GRAY.g, GX_COLOR_GRAY.b, GX_COLOR_GRAY.a);
+		xOffset += xStep;
+	}
+}
+
+// same as above, but into the vertex arrays
+// position x is the visible index when everything is shown, see drawGraphLineIndexed()
+static inline void fillGraphRun(int line, const ControllerSample *samples, const GraphRun *run,
+                                const size_t offset, const bool isSigned, GXColor color) {
+	const ControllerSample *sample = &samples[run->dataStart];
+	int drawIndex = run->drawStart;
+	for (int i = 0; i < run->count; i++) {
+		graphPositionArr[line][drawIndex][0] = drawIndex;
+		graphPositionArr[line][drawIndex][1] = getGraphSampleValue(&sample[i], offset, isSigned);
+		graphColorArr[line][drawIndex] = color;
+		drawIndex++;
+	}
+	for (int i = 0; i < run->blankCount; i++) {
+		graphPositionArr[line][drawIndex][0] = drawIndex;
+		graphPositionArr[line][drawIndex][1] = 0;
+		graphColorArr[line][drawIndex] = GX_COLOR_GRAY;
+		drawIndex++;
+	}
+}
+
+// draw one line of the graph in immediate mode
+// only the live continuous graph is drawn this way, so it's always a signed stick axis
+static void drawGraphLine(ControllerRec *data, const GraphRun runs[2], int runCount, size_t offset,
+                          int32_t sampleStep, int decimation, int yPosModifier, int z, GXColor color) {
+	beginPrimitive(GX_LINESTRIP, VTXFMT_PRIMITIVES_FIXED, getGraphVertexCount(decimation));
+	for (int i = 0; i < runCount; i++) {
+		emitGraphRun(data->samples, &runs[i], offset, true, sampleStep, decimation, yPosModifier, z, color);
+	}
+	GX_End();
+}
+
+// fill the graph vertex arrays from a recording, if they don't already hold it
+static void updateGraphVertexArrays(ControllerRec *data, enum GRAPH_TYPE type) {
+	if (graphArrData == data && graphArrRevision == data->revision && graphArrType == type &&
+	    graphArrAxis == drawnAxis && graphArrZeroIndexOffset == graphZeroIndexOffset &&
+	    graphArrSampleEnd == data->sampleEnd) {
+		return;
+	}
+	
+	// scrolling can go all the way to sampleEnd, so fill the whole thing
+	GraphRun runs[2];
+	int runCount = getGraphRuns(data, type, 0, REC_SAMPLE_MAX, runs);
+	size_t offsets[2];
+	getGraphLineOffsets(data, type, offsets);
+	
+	for (int i = 0; i < runCount; i++) {
+		if (type == GRAPH_TRIGGER) {
+			fillGraphRun(0, data->samples, &runs[i], offsets[0], false, GX_COLOR_WHITE);
+		} else {
+			fillGraphRun(0, data->samples, &runs[i], offsets[0], true, GX_COLOR_RED_X);
+			fillGraphRun(1, data->samples, &runs[i], offsets[1], true, GX_COLOR_BLUE_Y);
+		}
+	}
+	
+	// get the new data out of cache, and make sure the gpu doesn't use anything it already read
+	DCFlushRange(graphPositionArr, sizeof(graphPositionArr));
+	DCFlushRange(graphColorArr, sizeof(graphColorArr));
+	GX_InvVtxCache();
+	
+	graphArrData = data;
+	graphArrRevision = data->revision;
+	graphArrType = type;
+	graphArrAxis = drawnAxis;
+	graphArrZeroIndexOffset = graphZeroIndexOffset;
+	graphArrSampleEnd = data->sampleEnd;
+}
+
+// stick wants total time, and min/max
+static void getGraphStickStats(const ControllerSample *samples, int start, int count, size_t xOffset, size_t yOffset) {
+	const ControllerSample *sample = &samples[start];
+	graphXMin = graphXMax = getGraphSampleValue(&sample[0], xOffset, true);
+	graphYMin = graphYMax = getGraphSampleValue(&sample[0], yOffset, true);
+	
+	// we don't want to add the time from the first datapoint, we start counting _from_ there
+	for (int i = 1; i < count; i++) {
+		int currX = getGraphSampleValue(&sample[i], xOffset, true);
+		int currY = getGraphSampleValue(&sample[i], yOffset, true);
+		graphXMin = (currX < graphXMin) ? currX : graphXMin;
+		graphXMax = (currX > graphXMax) ? currX : graphXMax;
+		graphYMin = (currY < graphYMin) ? currY : graphYMin;
+		graphYMax = (currY > graphYMax) ? currY : graphYMax;
+		
+		// adding time from drawn points, to show how long the current view is
+		graphTimeUsecs += sample[i].timeDiffUs;
+	}
+	
+	int magnitudeX = abs(graphXMax) >= abs(graphXMin) ? abs(graphXMax) : abs(graphXMin);
+	int magnitudeY = abs(graphYMax) >= abs(graphYMin) ? abs(graphYMax) : abs(graphYMin);
+	
+	// this is slightly unintuitive
+	// this will be false because we draw the axis with the larger magnitude _second_
+	// which lets it show over the other axis
+	// Also, we don't use triggeringAxis here since the magnitude is screen-local
+	yMagnitudeIsGreater = (magnitudeY > magnitudeX);
+}
+
+// stick_full just needs frame intervals
+// this is different from every other frame interval calculation,
+// timeDiffUs is abused here to indicate frame intervals, 0 is not a frame interval, 1 is
+static int getGraphRingFrameIntervals(const ControllerSample *samples, const GraphRun runs[2], int runCount,
+                                      int32_t sampleStep, int16_t *intervalList, int intervalListMax) {
+	int intervalCount = 0;
+	for (int run = 0; run < runCount; run++) {
+		const ControllerSample *sample = &samples[runs[run].dataStart];
+		int runLength = runs[run].count + runs[run].blankCount;
+		for (int i = 0; i < runLength && intervalCount < intervalListMax; i++) {
+			if (sample[i].timeDiffUs == 1) {
+				// store where the current value is being drawn
+				// easier to do this than having to recalculate...
+				intervalList[intervalCount] = getGraphSampleXPos(runs[run].drawStart + i, sampleStep);
+				intervalCount++;
+			}
+		}
+	}
+	return intervalCount;
+}
+
+// triggers want frame intervals and digital presses
+static void getGraphTriggerStats(const ControllerSample *samples, int start, int count, uint16_t triggerMask,
+                                 int32_t sampleStep, int16_t *intervalList, int *intervalCount,
+                                 int16_t *pressList, int *pressCount) {
+	// more traditional way of calculating frame intervals
+	// timeFromLastInterval needs to match what it would be at the first point to draw,
+	// to ensure that frame intervals are consistent across a single recording
+	uint64_t timeFromLastInterval = 0;
+	for (int i = 0; i < start; i++) {
+		timeFromLastInterval += samples[i].timeDiffUs;
+		if (timeFromLastInterval >= FRAME_TIME_US) {
+			// just reset it, we don't actually need to know what the previous frame intervals were...
+			timeFromLastInterval = 0;
+		}
+	}
+	
+	const ControllerSample *sample = &samples[start];
+	bool digitalPressOccurring = false;
+	*intervalCount = *pressCount = 0;
+	
+	for (int i = 0; i < count; i++) {
+		int16_t windowXPos = getGraphSampleXPos(i, sampleStep);
+		
+		timeFromLastInterval += sample[i].timeDiffUs;
+		if (timeFromLastInterval >= FRAME_TIME_US) {
+			intervalList[*intervalCount] = windowXPos;
+			(*intervalCount)++;
+			timeFromLastInterval = 0;
+		}
+		
+		// digital presses
+		// this is done a bit differently than you'd expect
+		// we store the start and end windowXPos of a continuous segment of digital press
+		// pressCount is updated when the end point is found, or when we're out of data
+		if (sample[i].buttons & triggerMask) {
+			// we mark start point
+			if (!digitalPressOccurring) {
+				pressList[*pressCount] = windowXPos;
+				digitalPressOccurring = true;
+			}
+			// we're at the end of the list, mark this as the end point
+			else if (i == count - 1) {
+				pressList[*pressCount + 1] = windowXPos;
+				*pressCount += 2;
+				digitalPressOccurring = false;
+			}
+		}
+		// we encountered no digital press while looking for the endpoint...
+		else if (digitalPressOccurring) {
+			// mark this as the end point
+			pressList[*pressCount + 1] = windowXPos;
+			*pressCount += 2;
+			digitalPressOccurring = false;
+		}
+	}
+}
+
+// the samples the game would read in the visible part of the graph, and their visible index
+// for GRAPH_STICK, the last read before the visible range is included at index -1,
+// so the first step starts at the edge of the graph
+static int getGraphGameReads(const ControllerRec *data, enum GRAPH_TYPE type, const GraphRun runs[2], int runCount,
+                             int16_t *readList, const ControllerSample **readSamples, int readListMax) {
+	int readCount = 0;
+	
+	// continuous marks the samples the game reads as they come in, see contSamplingCallback()
+	if (type == GRAPH_STICK_FULL) {
+		for (int run = 0; run < runCount; run++) {
+			const ControllerSample *sample = &data->samples[runs[run].dataStart];
+			for (int i = 0; i < runs[run].count && readCount < readListMax; i++) {
+				if (sample[i].timeDiffUs == 1) {
+					readList[readCount] = runs[run].drawStart + i;
+					readSamples[readCount] = &sample[i];
+					readCount++;
+				}
+			}
+		}
+		return readCount;
+	}
+	
+	// everything else has real sample times, so we can put the reads wherever we want
+	FrameResampler resampler;
+	initFrameResampler(&resampler, graphGameReadsPhaseUs);
+	int start = runs[0].dataStart;
+	int end = start + runs[0].count;
+	// reads for a sample are only known once the next one is fed in, so this goes one past the end
+	for (int i = 0; i <= end && i < data->sampleEnd && readCount < readListMax; i++) {
+		if (feedFrameResampler(&resampler, data->samples[i].timeDiffUs) == 0) {
+			continue;
+		}
+		int readIndex = i - 1;
+		// only the latest one before the visible range is kept, they all come before anything visible
+		if (readIndex < start) {
+			readList[0] = -1;
+			readSamples[0] = &data->samples[readIndex];
+			readCount = 1;
+			continue;
+		}
+		readList[readCount] = readIndex - start;
+		readSamples[readCount] = &data->samples[readIndex];
+		readCount++;
+	}
+	return readCount;
+}
+
+// draw one axis of the game reads as steps, each value is held until the next read
+static void drawGraphGameReads(const int16_t *readList, const ControllerSample **readSamples, int readCount,
+                               size_t offset, int32_t sampleStep, int lastXPos, int yPosModifier, int z,
+                               GXColor color) {
+	if (readCount == 0) {
+		return;
+	}
+	
+	beginPrimitive(GX_LINES, VTXFMT_PRIMITIVES_INT, readCount * 4);
+	for (int i = 0; i < readCount; i++) {
+		int xPos = (readList[i] < 0) ? SCREEN_TIMEPLOT_START : getGraphSampleXPos(readList[i], sampleStep);
+		int yPos = yPosModifier - getGraphSampleValue(readSamples[i], offset, true);
+		int nextXPos = lastXPos, nextYPos = yPos;
+		if (i + 1 < readCount) {
+			nextXPos = getGraphSampleXPos(readList[i + 1], sampleStep);
+			nextYPos = yPosModifier - getGraphSampleValue(readSamples[i + 1], offset, true);
+		}
+		
+		// held for the frame
+		GX_Position3s16(xPos, yPos, z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+		GX_Position3s16(nextXPos, yPos, z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+		
+		// then moves to the next read
+		GX_Position3s16(nextXPos, yPos, z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+		GX_Position3s16(nextXPos, nextYPos, z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+	}
+	GX_End();
+}
+
+// ticks along the bottom for each marker in the visible runs, same height as the frame intervals at the top
+static void drawGraphMarkers(const GraphRun runs[2], int runCount, int32_t sampleStep, int z) {
+	int16_t markerXPos[GRAPH_MARKER_MAX];
+	const GraphMarker *visibleMarkers[GRAPH_MARKER_MAX];
+	int visibleCount = 0;
+	for (int i = 0; i < graphMarkerCount; i++) {
+		for (int run = 0; run < runCount; run++) {
+			int drawIndex = graphMarkers[i].dataIndex - runs[run].dataStart;
+			if (drawIndex >= 0 && drawIndex < runs[run].count) {
+				markerXPos[visibleCount] = getGraphSampleXPos(runs[run].drawStart + drawIndex, sampleStep);
+				visibleMarkers[visibleCount] = &graphMarkers[i];
+				visibleCount++;
+				break;
+			}
+		}
+	}
+	if (visibleCount == 0) {
+		return;
+	}
+	
+	beginPrimitive(GX_LINES, VTXFMT_PRIMITIVES_INT, visibleCount * 2);
+	for (int i = 0; i < visibleCount; i++) {
+		GXColor color = visibleMarkers[i]->color;
+		GX_Position3s16(markerXPos[i], (SCREEN_POS_CENTER_Y + 112), z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+		
+		GX_Position3s16(markerXPos[i], (SCREEN_POS_CENTER_Y + 127), z);
+		GX_Color4u8(color.r, color.g, color.b, color.a);
+	}
+	GX_End();
+}
+
+// draw one line of the graph from the vertex arrays
+// the position matrix does the work of turning (sample index, value) into screen coordinates
+static void drawGraphLineIndexed(int line, float unitsPerSample, int decimation, int yPosModifier, int z) {
+	// batched primitives need to go out before the matrix changes
+	flushPrimitiveBatch();
+	
+	Mtx graphMtx, graphModelview;
+	guMtxIdentity(graphMtx);
+	guMtxScaleApply(graphMtx, graphMtx, unitsPerSample, -1.0f, 1.0f);
+	guMtxTransApply(graphMtx, graphMtx, SCREEN_TIMEPLOT_START - (unitsPerSample * graphScrollOffset), yPosModifier, z);
+	guMtxConcat(modelview, graphMtx, graphModelview);
+	loadPosMtx(graphModelview, GX_PNMTX1);
+	setCurrentMtx(GX_PNMTX1);
+	
+	updateVtxDesc(VTX_INDEXED, GX_PASSCLR);
+	GX_SetArray(GX_VA_POS, graphPositionArr[line], sizeof(graphPositionArr[line][0]));
+	GX_SetArray(GX_VA_CLR0, graphColorArr[line], sizeof(GXColor));
+	
+	beginPrimitive(GX_LINESTRIP, VTXFMT_INDEXED_GRAPH, getGraphVertexCount(decimation));
+	for (int i = graphScrollOffset; i < graphScrollOffset + graphVisibleDatapoints; i += decimation) {
+		GX_Position1x16(i);
+		GX_Color1x16(i);
+	}
+	GX_End();
+	
+	setCurrentMtx(GX_PNMTX0);
+	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
+}
+
 // actually draw the graph
 // we're just gonna ignore alphaValue here, doesn't really make sense to use in this context...
 void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen) {
+	#ifdef BENCH
+	uint64_t graphStartTick = gettime();
+	#endif
+	
 	// since we do a bunch of draw calls here, its easier just to store this ourselves...
 	int initialZValue = zPrevDepth;
 	// don't allow further draw() calls to attempt to reset the zdepth
@@ -681,241 +1547,97 @@ void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen) {
 		yPosModifier += 128;
 	}
 	
-	// calculate how many points we're going to draw
-	// we also get miscellaneous information here, such as min/max, digital press for trigger, and frame intervals
+	// calculate units per shown sample
+	// float is only used for the vertex array matrix, everything else uses fixed point
+	float waveformScreenUnitPer = WAVEFORM_DISPLAY_WIDTH / (graphVisibleDatapoints - 1);
+	int32_t sampleStep = getGraphSampleStep();
+	
+	// figure out where our data is, and what each line reads
+	GraphRun runs[2];
+	int runCount = getGraphRuns(data, type, graphScrollOffset, graphVisibleDatapoints, runs);
+	size_t lineOffsets[2];
+	getGraphLineOffsets(data, type, lineOffsets);
+	
+	// miscellaneous information, such as min/max, digital press for trigger, and frame intervals
 	int frameIntervalIndex = 0;
-	float frameIntervalList[500];
-	uint64_t timeFromLastInterval = 0;
+	int16_t frameIntervalList[500];
 	int digitalPressInterval = 0;
-	float digitalPressList[500];
-	bool digitalPressOccurring = false;
+	int16_t digitalPressList[500];
 	graphXMin = graphYMin = 0;
 	graphXMax = graphYMax = 0;
 	yMagnitudeIsGreater = false;
 	graphTimeUsecs = 0;
 	
-	// for GRAPH_TRIGGER, we need to update timeFromLastInterval to match what it would be at the first point to draw
-	if (type == GRAPH_TRIGGER && graphScrollOffset != 0) {
-		for (int i = 0; i < graphScrollOffset; i++) {
-			timeFromLastInterval += data->samples[i].timeDiffUs;
-			if (timeFromLastInterval >= FRAME_TIME_US) {
-				// just reset it, we don't actually need to know what the previous frame intervals were...
-				timeFromLastInterval = 0;
+	// either 1 or -1, depending on where the Y axis needs to be drawn
+	int lineModifier = 0;
+	
+	switch (type) {
+		case GRAPH_STICK:
+			getGraphStickStats(data->samples, graphScrollOffset, graphVisibleDatapoints, lineOffsets[0], lineOffsets[1]);
+			// draw Y above if it has the larger magnitude
+			lineModifier = yMagnitudeIsGreater ? 1 : -1;
+			break;
+		case GRAPH_STICK_FULL:
+			// we only populate the list if we are partially zoomed in
+			if (graphVisibleDatapoints <= 1500) {
+				frameIntervalIndex = getGraphRingFrameIntervals(data->samples, runs, runCount, sampleStep,
+				                                                frameIntervalList, 500);
 			}
-		}
+			// we always draw Y axis below in continuous oscilloscope
+			lineModifier = -1;
+			break;
+		case GRAPH_TRIGGER:
+			getGraphTriggerStats(data->samples, graphScrollOffset, graphVisibleDatapoints,
+			                     (data->recordingType == REC_TRIGGER_L) ? PAD_TRIGGER_L : PAD_TRIGGER_R,
+			                     sampleStep, frameIntervalList, &frameIntervalIndex,
+			                     digitalPressList, &digitalPressInterval);
+			break;
 	}
 	
-	// calculate units per shown sample
-	float waveformScreenUnitPer = WAVEFORM_DISPLAY_WIDTH / (graphVisibleDatapoints - 1);
-	
-	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-	
-	int linesToDraw = 1;
-	
-	// both stick graphs draw two lines
-	if (data->recordingType != REC_TRIGGER_L && data->recordingType != REC_TRIGGER_R) {
-		linesToDraw = 2;
+	// recordings that aren't going to change are drawn from vertex arrays,
+	// continuous only stops changing when its locked
+	bool useVertexArrays = (type != GRAPH_STICK_FULL || isFrozen);
+	if (useVertexArrays) {
+		updateGraphVertexArrays(data, type);
 	}
 	
-	// either 1 or -1, depending on where the next axis needs to be drawn
-	int lineModifier = 0;
+	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
 	
-	// line = 0 -> draw X axis OR draw trigger
-	// calculate stat values while drawing (frame intervals, min/max, digital presses)
-	// use those values to determine if Y should be drawn above or below
-	// line = 1 -> draw Y axis at zDepth + lineModifier OR leave loop because trigger
+	// X axis (or trigger) first, then Y at zDepth + lineModifier
+	int decimation = getGraphDecimation();
+	int linesToDraw = (type == GRAPH_TRIGGER) ? 1 : 2;
 	for (int line = 0; line < linesToDraw; line++) {
-		// set color of line based on what we're drawing
-		GXColor lineColor = (line == 0) ? GX_COLOR_RED_X : GX_COLOR_BLUE_Y;
-		if (type == GRAPH_TRIGGER) {
-			lineColor = GX_COLOR_WHITE;
-		}
-		
-		GX_Begin(GX_LINESTRIP, VTXFMT_PRIMITIVES_FLOAT, graphVisibleDatapoints);
-		
-		for (int i = 0; i < graphVisibleDatapoints; i++) {
-			int dataIndex = i + graphScrollOffset;
-			
-			// window x position based on how many points we've drawn
-			float windowXPos = SCREEN_TIMEPLOT_START + (waveformScreenUnitPer * (i));
-		
-			int currSampleValue = 0;
-			// for trigger digital press detection
-			uint16_t currSampleTriggerMask = 0;
-			// get our value for graphing
-			switch (type) {
-				case GRAPH_STICK_FULL:
-					// offset index by the base offset provided, mod to ensure we're in range
-					dataIndex = (dataIndex + graphZeroIndexOffset) % graphMaxVisibleDatapoints;
-					
-					// gray out line that isn't recorded yet
-					if (i > graphZeroIndexOffset && data->sampleEnd != graphMaxVisibleDatapoints) {
-						lineColor = GX_COLOR_GRAY;
-					} else
-					// fall through to the next if
-				case GRAPH_STICK:
-					// are we looking at data that exists?
-					if (dataIndex < data->sampleEnd) {
-						// get x or y
-						currSampleValue = line == 0 ?
-						                  getControllerSampleXValue(data->samples[dataIndex], drawnAxis) :
-						                  getControllerSampleYValue(data->samples[dataIndex], drawnAxis);
-						lineColor = (line == 0) ? GX_COLOR_RED_X : GX_COLOR_BLUE_Y;
-					} else {
-						// we're beyond the list, draw at 0 with gray
-						lineColor = GX_COLOR_GRAY;
-					}
-					break;
-				case GRAPH_TRIGGER:
-					// either trigger L or R
-					if (data->recordingType == REC_TRIGGER_L) {
-						currSampleValue = data->samples[dataIndex].triggerL;
-						currSampleTriggerMask = PAD_TRIGGER_L;
-					} else {
-						currSampleValue = data->samples[dataIndex].triggerR;
-						currSampleTriggerMask = PAD_TRIGGER_R;
-					}
-					break;
-			}
-			
-			// calculate stat values
-			// this only needs to happen during the first run of the outside for loop
-			if (line == 0) {
-				switch (type) {
-					// stick wants total time, and min/max
-					case GRAPH_STICK:
-						// get both x and y at once
-						int8_t currX, currY;
-						getControllerSampleAxisPair(data->samples[dataIndex], drawnAxis, &currX, &currY);
-						
-						// update min/max
-						if (graphXMin > currX) {
-							graphXMin = currX;
-						}
-						if (graphXMax < currX) {
-							graphXMax = currX;
-						}
-						if (graphYMin > currY) {
-							graphYMin = currY;
-						}
-						if (graphYMax < currY) {
-							graphYMax = currY;
-						}
-						
-						// set initial stat values if this is the first datapoint
-						if (i == 0) {
-							graphXMin = graphXMax = currX;
-							graphYMin = graphYMax = currY;
-						}
-						// we don't want to add the time from the first datapoint, we start counting _from_ there
-						else {
-							// adding time from drawn points, to show how long the current view is
-							graphTimeUsecs += data->samples[dataIndex].timeDiffUs;
-						}
-						break;
-					// stick_full just needs frame intervals
-					// this is different from every other frame interval calculation
-					case GRAPH_STICK_FULL:
-						// timeDiffUs is abused here to indicate frame intervals, 0 is not a frame interval, 1 is
-						if (data->samples[dataIndex].timeDiffUs == 1) {
-							// we only populate the list if we are partially zoomed in
-							// also make sure we don't overrun our array...
-							if (graphVisibleDatapoints <= 1500 && frameIntervalIndex < 500) {
-								// store where the current value is being drawn
-								// easier to do this than having to recalculate...
-								frameIntervalList[frameIntervalIndex] = windowXPos;
-								frameIntervalIndex++;
-							}
-						}
-						break;
-					// triggers want frame intervals and digital presses
-					case GRAPH_TRIGGER:
-						// more traditional way of calculating frame intervals
-						// timeFromLastInterval is updated with data from before drawing,
-						// to ensure that frame intervals are consistent across a single recording
-						timeFromLastInterval += data->samples[dataIndex].timeDiffUs;
-						if (timeFromLastInterval >= FRAME_TIME_US) {
-							frameIntervalList[frameIntervalIndex] = windowXPos;
-							frameIntervalIndex++;
-							timeFromLastInterval = 0;
-						}
-						
-						// digital presses
-						// this is done a bit differently than you'd expect
-						// we store the start and end windowXPos of a continuous segment of digital press
-						// digitalPressInterval is updated when the end point is found, or when we're out of data
-						if (data->samples[dataIndex].buttons & currSampleTriggerMask) {
-							// we mark start point
-							if (!digitalPressOccurring) {
-								digitalPressList[digitalPressInterval] = windowXPos;
-								if (i == 0) {
-									// if this is the first datapoint, start line from start of plot...
-									//digitalPressList[digitalPressInterval] = SCREEN_TIMEPLOT_START;
-								}
-								digitalPressOccurring = true;
-							}
-							// we're at the end of the list, mark this as the end point
-							else if (i == graphVisibleDatapoints - 1) {
-								digitalPressList[digitalPressInterval + 1] = windowXPos;
-								digitalPressInterval += 2;
-								digitalPressOccurring = false;
-							}
-						}
-						// we encountered no digital press while looking for the endpoint...
-						else if (digitalPressOccurring) {
-							// mark this as the end point
-							digitalPressList[digitalPressInterval + 1] = windowXPos;
-							digitalPressInterval += 2;
-							digitalPressOccurring = false;
-						}
-						break;
-				}
-			}
-			
-			// actually draw the vertex
-			GX_Position3f32(windowXPos, yPosModifier - currSampleValue, zDepth + lineModifier);
-			GX_Color4u8(lineColor.r, lineColor.g, lineColor.b, lineColor.a);
+		int lineZ = zDepth + ((line == 0) ? 0 : lineModifier);
+		if (useVertexArrays) {
+			drawGraphLineIndexed(line, waveformScreenUnitPer, decimation, yPosModifier, lineZ);
+		} else {
+			drawGraphLine(data, runs, runCount, lineOffsets[line], sampleStep, decimation, yPosModifier, lineZ,
+			              (line == 0) ? GX_COLOR_RED_X : GX_COLOR_BLUE_Y);
 		}
-		
-		GX_End();
-		
-		// finalize stats based on results
-		if (line == 0) {
-			switch (type) {
-				// determine if Y should be drawn above or below
-				case GRAPH_STICK:
-					int magnitudeX = abs(graphXMax) >= abs(graphXMin) ? abs(graphXMax) : abs(graphXMin);
-					int magnitudeY = abs(graphYMax) >= abs(graphYMin) ? abs(graphYMax) : abs(graphYMin);
-					
-					// this is slightly unintuitive
-					// this will be false because we draw the axis with the larger magnitude _second_
-					// which lets it show over the other axis
-					// Also, we don't use triggeringAxis here since the magnitude is screen-local
-					if (magnitudeY > magnitudeX) {
-						lineModifier = 1;
-						yMagnitudeIsGreater = true;
-						break;
-					}
-					// fail case matches with what STICK_FULL does, so don't break if above check fails
-				// stick_full just needs frame intervals
-				// this is different from every other frame interval calculation
-				case GRAPH_STICK_FULL:
-					// we always draw Y axis below in continuous oscilloscope
-					lineModifier = -1;
-					break;
-				case GRAPH_TRIGGER:
-					// nothing to really do here...
-				default:
-					break;
-			}
+	}
+	
+	// what the game would read, drawn over both lines
+	if (graphGameReadsEnabled && type != GRAPH_TRIGGER) {
+		int16_t readList[500];
+		const ControllerSample *readSamples[500];
+		int readCount = getGraphGameReads(data, type, runs, runCount, readList, readSamples, 500);
+		int readZ = zDepth + ((lineModifier > 0) ? lineModifier : 0) + 1;
+		int lastXPos = getGraphSampleXPos(graphVisibleDatapoints - 1, sampleStep);
+		for (int line = 0; line < 2; line++) {
+			drawGraphGameReads(readList, readSamples, readCount, lineOffsets[line], sampleStep, lastXPos,
+			                   yPosModifier, readZ, (line == 0) ? GX_COLOR_LIGHTRED_X : GX_COLOR_LIGHTBLUE_Y);
 		}
 	}
 	
+	if (graphMarkerCount != 0 && type != GRAPH_TRIGGER) {
+		drawGraphMarkers(runs, runCount, sampleStep, zDepth + lineModifier - 2);
+	}
+	
 	// draw frame intervals
 	switch (type) {
 		case GRAPH_TRIGGER:
 			// draw digital presses
-			GX_Begin(GX_LINES, VTXFMT_PRIMITIVES_INT, digitalPressInterval);
+			beginPrimitive(GX_LINES, VTXFMT_PRIMITIVES_INT, digitalPressInterval);
 			for (int i = 0; i < digitalPressInterval; i++) {
 				GX_Position3s16(digitalPressList[i], (SCREEN_POS_CENTER_Y + 28), zDepth + lineModifier - 2);
 				GX_Color4u8(GX_COLOR_GREEN.r, GX_COLOR_GREEN.g, GX_COLOR_GREEN.b, GX_COLOR_GREEN.a);
@@ -924,7 +1646,7 @@ void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen) {
 		case GRAPH_STICK_FULL:
 			// draw frame intervals
 			// *2 since each line has two vertices
-			GX_Begin(GX_LINES, VTXFMT_PRIMITIVES_INT, frameIntervalIndex * 2);
+			beginPrimitive(GX_LINES, VTXFMT_PRIMITIVES_INT, frameIntervalIndex * 2);
 			for (int i = 0; i < frameIntervalIndex; i++) {
 				GX_Position3s16(frameIntervalList[i], (SCREEN_POS_CENTER_Y - 127), zDepth + lineModifier - 2);
 				GX_Color4u8(GX_COLOR_GRAY.r, GX_COLOR_GRAY.g, GX_COLOR_GRAY.b, GX_COLOR_GRAY.a);
@@ -969,7 +1691,7 @@ void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen) {
 		drawLine(SCREEN_TIMEPLOT_START + sliderStart, SCREEN_POS_CENTER_Y - 128,
 		         SCREEN_TIMEPLOT_START + sliderEnd, SCREEN_POS_CENTER_Y - 128,
 		         GX_COLOR_WHITE);
-		GX_SetLineWidth(12, GX_TO_ZERO);
+		setLineWidth(12);
 		restorePrevDepth();
 	}
 	
@@ -1015,6 +1737,161 @@ void drawGraph(ControllerRec *data, enum GRAPH_TYPE type, bool isFrozen) {
 	if (resetAlphaAfter) {
 		restorePrevAlphaFromDrawCall();
 	}
+	
+	#ifdef BENCH
+	frameStats.graphUs += ticks_to_microsecs(gettime() - graphStartTick);
+	#endif
+}
+
+// colors for startRecordingPoints(), indexed by whether buttons are pressed
+static GXColor recordingPointColors[2] ATTRIBUTE_ALIGN(32) = { GX_COLOR_WHITE, GX_COLOR_ORANGE };
+static const ControllerRec *recordingPointData = NULL;
+static uint32_t recordingPointRevision = 0;
+
+void startRecordingPoints(ControllerRec *data, enum CONTROLLER_STICK_AXIS axis, int originX, int originY) {
+	// samples only need to leave the cache once per recording
+	if (recordingPointData != data || recordingPointRevision != data->revision) {
+		DCFlushRange(data->samples, sizeof(data->samples));
+		GX_InvVtxCache();
+		recordingPointData = data;
+		recordingPointRevision = data->revision;
+	}
+	
+	// batched primitives need to go out before the matrix changes
+	flushPrimitiveBatch();
+	
+	// stick y is flipped for screen coordinates
+	Mtx pointMtx, pointModelview;
+	guMtxIdentity(pointMtx);
+	guMtxScaleApply(pointMtx, pointMtx, 1.0f, -1.0f, 1.0f);
+	guMtxTransApply(pointMtx, pointMtx, originX, originY, zDepth);
+	guMtxConcat(modelview, pointMtx, pointModelview);
+	loadPosMtx(pointModelview, GX_PNMTX1);
+	setCurrentMtx(GX_PNMTX1);
+	
+	updateVtxDesc(VTX_INDEXED, GX_PASSCLR);
+	// x and y are next to each other in ControllerSample, so we can point right at them
+	if (axis == AXIS_CXY) {
+		GX_SetArray(GX_VA_POS, &(data->samples[0].cStickX), sizeof(ControllerSample));
+	} else {
+		GX_SetArray(GX_VA_POS, &(data->samples[0].stickX), sizeof(ControllerSample));
+	}
+	GX_SetArray(GX_VA_CLR0, recordingPointColors, sizeof(GXColor));
+}
+
+void drawRecordingPoints(int start, int count) {
+	const ControllerSample *samples = recordingPointData->samples;
+	beginPrimitive(GX_POINTS, VTXFMT_INDEXED_POINTS, count);
+	for (int i = start; i < start + count; i++) {
+		GX_Position1x16(i);
+		GX_Color1x16(samples[i].buttons != 0);
+	}
+	GX_End();
+}
+
+void drawRecordingPointList(const int *indices, int count) {
+	const ControllerSample *samples = recordingPointData->samples;
+	beginPrimitive(GX_POINTS, VTXFMT_INDEXED_POINTS, count);
+	for (int i = 0; i < count; i++) {
+		GX_Position1x16(indices[i]);
+		GX_Color1x16(samples[indices[i]].buttons != 0);
+	}
+	GX_End();
+}
+
+void endRecordingPoints() {
+	setCurrentMtx(GX_PNMTX0);
+	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
+	
+	if (resetZDepthAfter) {
+		restorePrevDepthFromDrawCall();
+	}
+}
+
+// log2 scale, so a single sample is still visible next to something held for a long time
+// zero stays zero, which is also fully transparent since I8 uses intensity for alpha
+static inline uint8_t heatmapCountToIntensity(uint16_t count) {
+	if (count == 0) {
+		return 0;
+	}
+	// number of bits needed for count, 1-16
+	int bits = 32 - __builtin_clz(count);
+	return 31 + (bits * 14);
+}
+
+void clearHeatmap() {
+	memset(heatmapCounts, 0, sizeof(heatmapCounts));
+	// everything needs to be converted again
+	memset(heatmapDirtyTiles, 0xFF, sizeof(heatmapDirtyTiles));
+}
+
+void addHeatmapSamples(ControllerRec *data, enum CONTROLLER_STICK_AXIS axis, int start, int end) {
+	for (int i = start; i < end; i++) {
+		int x, y;
+		if (axis == AXIS_CXY) {
+			x = data->samples[i].cStickX;
+			y = data->samples[i].cStickY;
+		} else {
+			x = data->samples[i].stickX;
+			y = data->samples[i].stickY;
+		}
+		// same orientation as the screen, positive y is up
+		int col = x + 128;
+		int row = 128 - y;
+		if (row > HEATMAP_SIZE - 1) {
+			row = HEATMAP_SIZE - 1;
+		}
+		
+		if (heatmapCounts[row][col] != UINT16_MAX) {
+			heatmapCounts[row][col]++;
+		}
+		int tile = (row / HEATMAP_TILE_HEIGHT) * HEATMAP_TILES_PER_ROW + (col / HEATMAP_TILE_WIDTH);
+		heatmapDirtyTiles[tile / 32] |= (1u << (tile % 32));
+	}
+}
+
+// convert dirty tiles to texels, and flush just those from cache
+static void updateHeatmapTexture() {
+	bool anyDirty = false;
+	for (int word = 0; word < HEATMAP_TILE_COUNT / 32; word++) {
+		uint32_t bits = heatmapDirtyTiles[word];
+		while (bits != 0) {
+			int bit = __builtin_ctz(bits);
+			bits &= bits - 1;
+			
+			int tile = (word * 32) + bit;
+			int rowStart = (tile / HEATMAP_TILES_PER_ROW) * HEATMAP_TILE_HEIGHT;
+			int colStart = (tile % HEATMAP_TILES_PER_ROW) * HEATMAP_TILE_WIDTH;
+			uint8_t *texel = &heatmapTexels[tile * HEATMAP_TILE_WIDTH * HEATMAP_TILE_HEIGHT];
+			for (int row = rowStart; row < rowStart + HEATMAP_TILE_HEIGHT; row++) {
+				for (int col = colStart; col < colStart + HEATMAP_TILE_WIDTH; col++) {
+					*texel = heatmapCountToIntensity(heatmapCounts[row][col]);
+					texel++;
+				}
+			}
+			// a tile is exactly one cache line
+			DCFlushRange(&heatmapTexels[tile * HEATMAP_TILE_WIDTH * HEATMAP_TILE_HEIGHT],
+			             HEATMAP_TILE_WIDTH * HEATMAP_TILE_HEIGHT);
+		}
+		if (heatmapDirtyTiles[word] != 0) {
+			anyDirty = true;
+			heatmapDirtyTiles[word] = 0;
+		}
+	}
+	
+	// gp might still have the old texels in its texture cache
+	if (anyDirty) {
+		flushPrimitiveBatch();
+		GX_InvalidateTexAll();
+	}
+}
+
+void drawHeatmap(int x1, int y1, GXColor color) {
+	updateHeatmapTexture();
+	
+	updateVtxDesc(VTX_TEXTURES, GX_MODULATE);
+	changeLoadedTexmap(TEXMAP_HEATMAP);
+	drawTextureFull(x1, y1, color);
 }
 
 enum TEX_ROTATE tempRotation = ROTATE_0;
@@ -1044,7 +1921,7 @@ void drawTextureFullScaled(int x1, int y1, int x2, int y2, GXColor color) {
 	                           { x2, y2 },
 	                           { x1, y2 } };
 	
-	GX_Begin(GX_QUADS, VTXFMT_TEXTURES, 4);
+	beginPrimitive(GX_QUADS, VTXFMT_TEXTURES, 4);
 	
 	for (int i = 0; i < 4; i++) {
 		int x = vectorPairList[(i + tempRotation) % 4][0];
@@ -1100,7 +1977,7 @@ void drawSubTexture(int x1, int y1, int x2, int y2, int tx1, int ty1, int tx2, i
 	                            { tx2, ty2 },
 	                            { tx1, ty2 } };
 
-	GX_Begin(GX_QUADS, VTXFMT_TEXTURES, 4);
+	beginPrimitive(GX_QUADS, VTXFMT_TEXTURES, 4);
 	
 	for (int i = 0; i < 4; i++) {
 		int x = vectorPairList[(i + tempRotation) % 4][0];
@@ -1251,9 +2128,9 @@ static void drawSnowParticles() {
 		}
 	}
 	
-	GX_SetPointSize(16, GX_TO_ZERO);
+	setPointSize(16);
 	updateVtxDesc(VTX_PRIMITIVES, GX_PASSCLR);
-	GX_Begin(GX_POINTS, VTXFMT_PRIMITIVES_INT, numOfParticles);
+	beginPrimitive(GX_POINTS, VTXFMT_PRIMITIVES_INT, numOfParticles);
 	
 	// iterate over our current number of particles
 	for (int i = 0; i < numOfParticles; i++) {
@@ -1323,7 +2200,7 @@ static void drawSnowParticles() {
 	
 	GX_End();
 	
-	GX_SetPointSize(12, GX_TO_ZERO);
+	setPointSize(12);
 	
 	// this is technically useless, since it gets called from a function that doesn't allow restoring
 	if (resetZDepthAfter) {
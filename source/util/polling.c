@@ -7,6 +7,8 @@
 #include <ogc/video.h>
 #include <ogc/video_types.h>
 #include <ogc/si.h>
+#include <ogc/timesupp.h>
+#include <ogc/irq.h>
 
 #ifdef DEBUGLOG
 #include "util/logging.h"
@@ -136,6 +138,14 @@ PADStatus getOriginStatus(enum CONT_PORTS_BITFLAGS port) {
 
 static uint32_t padsConnected = 0;
 
+// when the controller was last read for a frame, and when the frame that used it was sent off,
+// see measureInputLatency()
+// frameReadTick is only set on the main thread, sampling callbacks call readController(false) all the time,
+// but the frame only uses what was read when it was drawn
+static uint64_t frameReadTick = 0;
+static volatile uint64_t queuedReadTick = 0;
+static volatile uint32_t inputLatencyUs = 0;
+
 // read controller
 // updates buttonsPressed, buttonsHeld, which controllers are connected, and origin information
 // the bool determines if we should attempt to update buttonsPressed
@@ -154,6 +164,8 @@ void readController(bool updatePressed) {
 	
 	// handle 'pressed' buttons
 	if (updatePressed) {
+		// this is the once per frame read, from the main thread
+		frameReadTick = gettime();
 		if (!readHigh) {
 			// update normally
 			buttonsDown = PAD_ButtonsDown(0);
@@ -183,3 +195,42 @@ bool isControllerConnected(enum CONT_PORTS_BITFLAGS port) {
 	// so we shift 0b0001 depending on the port number (0, 1, 2, 3)
 	return ( padsConnected & (1 << port) );
 }
+
+void readLatestControllerStatus(PADStatus *status) {
+	// PAD_Read() doesn't update what PAD_ScanPads() compares against, so ButtonsDown() isn't affected
+	// not clamped, PAD_StickX() and the rest are raw too, and everything is drawn in raw units
+	PADStatus pads[PAD_CHANMAX];
+	PAD_Read(pads);
+	if (pads[0].err == PAD_ERR_NONE) {
+		*status = pads[0];
+		frameReadTick = gettime();
+	} else {
+		*status = (PADStatus) { 0 };
+		status->button = buttonsHeld;
+		status->stickX = PAD_StickX(0);
+		status->stickY = PAD_StickY(0);
+		status->substickX = PAD_SubStickX(0);
+		status->substickY = PAD_SubStickY(0);
+		status->triggerL = PAD_TriggerL(0);
+		status->triggerR = PAD_TriggerR(0);
+	}
+}
+
+void markFrameQueued() {
+	// the retrace callback reads this, and a 64-bit write is two stores, so it can't land between them
+	uint32_t level;
+	_CPU_ISR_Disable(level);
+	queuedReadTick = frameReadTick;
+	_CPU_ISR_Restore(level);
+}
+
+void measureInputLatency() {
+	if (queuedReadTick != 0) {
+		inputLatencyUs = ticks_to_microsecs(gettime() - queuedReadTick);
+		queuedReadTick = 0;
+	}
+}
+
+uint32_t getInputLatencyUs() {
+	return inputLatencyUs;
+}
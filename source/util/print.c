@@ -45,126 +45,306 @@ static void advanceCursorLine() {
 static int workingHorizontalPadding = PRINT_PADDING_HORIZONTAL;
 
 static bool allowWordWrap = false;
-static int lastSpaceListIndex = 0;
-static const char* lastSpaceList[50] = { NULL };
 
-// this is almost directly adapted from the provided romfont example, but modified for our specific fontsheet,
-// as well as support for background colors
-// TODO: this might not respect a call to setDepthForDrawCall(), investigate...
-static void handleString(bool draw, GXColor bgColor, GXColor fgColor) {
-	// pointer for iterating over string
-	const char* curr = strBuffer;
+// text layout cache
+// a given string is laid out once (line breaks, glyph positions, background spans), and then reused
+// for as long as the string, starting x position, usable width, and word wrap setting stay the same.
+// entries are found by hash in a set of LAYOUT_CACHE_WAYS, and a new string replaces the least recently used one,
+// so strings that change every frame only push out each other, not the long ones drawn every frame.
+// a replaced entry's space in the pools is reused if the new string fits in it, otherwise space comes from the end
+// of the pools, and the whole cache is only dropped once they run out.
+// short strings are cheap to lay out and are usually numbers that keep changing, so they're never cached
+#define LAYOUT_CACHE_SETS 64
+#define LAYOUT_CACHE_WAYS 2
+#define LAYOUT_CACHE_MIN_LENGTH 24
+// worst case for a string is one glyph per char, and one line per char (plus the last line)
+// the start of the glyph and line pools is kept for short strings
+#define LAYOUT_POOL_SIZE 8192
+#define LAYOUT_POOL_RESERVED (LAYOUT_CACHE_MIN_LENGTH + 1)
+
+typedef struct LayoutGlyph {
+	int16_t x;
+	uint16_t line;
+	// index into the font sheet
+	uint8_t charIndex;
+} LayoutGlyph;
+
+typedef struct LayoutEntry {
+	bool used;
+	// for picking which entry in a set gets replaced
+	uint32_t lastUse;
+	// longest string that fits in this entry's space in the pools
+	int capacity;
 	
-	// stores size of a given character from the font
-	int texturePosX1, texturePosY1;
+	uint32_t hash;
+	int length;
+	int startX;
+	int lineWidth;
+	bool wordWrap;
 	
-	// starting cursor values, stored so that we can restore them if we didn't actually print anything
-	int startingX = cursorX, startingY = cursorY;
-	// "working" values, used to determine if we need to draw a background color
-	int workingX = startingX, workingY = startingY;
+	// offsets into the pools
+	int charStart;
+	int glyphStart, glyphCount;
+	int lineStart, lineCount;
 	
-	int workingSpaceIndex = 0;
+	// cursor x after the string is printed
+	int endX;
+} LayoutEntry;
+
+static LayoutEntry layoutEntries[LAYOUT_CACHE_SETS][LAYOUT_CACHE_WAYS];
+static uint32_t layoutUseCount = 0;
+// short strings, laid out into the reserved part of the pools every time
+static LayoutEntry layoutScratchEntry;
+
+static char layoutCharPool[LAYOUT_POOL_SIZE];
+static int layoutCharPoolUsed = 0;
+static LayoutGlyph layoutGlyphPool[LAYOUT_POOL_SIZE];
+static int layoutGlyphPoolUsed = LAYOUT_POOL_RESERVED;
+// x value where a given line ends, used for background color
+static int16_t layoutLineEndPool[LAYOUT_POOL_SIZE];
+// first glyph of a given line, relative to the entry's glyphStart
+// glyphs are always stored in line order, so this is enough to only draw the lines we can see
+static uint16_t layoutLineGlyphPool[LAYOUT_POOL_SIZE];
+static int layoutLinePoolUsed = LAYOUT_POOL_RESERVED;
+
+static void clearLayoutCache() {
+	for (int i = 0; i < LAYOUT_CACHE_SETS; i++) {
+		for (int j = 0; j < LAYOUT_CACHE_WAYS; j++) {
+			layoutEntries[i][j].used = false;
+		}
+	}
+	layoutCharPoolUsed = 0;
+	layoutGlyphPoolUsed = LAYOUT_POOL_RESERVED;
+	layoutLinePoolUsed = LAYOUT_POOL_RESERVED;
+}
+
+// fnv-1a
+static uint32_t hashString(const char *str, int length) {
+	uint32_t hash = 2166136261u;
+	for (int i = 0; i < length; i++) {
+		hash ^= (uint8_t) str[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// this was originally adapted from the provided romfont example, but modified for our specific fontsheet,
+// as well as support for background colors and word wrap.
+// all positions are relative to the padding, glyph y values are stored as a line number since the line height
+// can be changed with setPrintOffset()
+// glyphStart and lineStart need to already have enough room for the string
+static void layoutString(LayoutEntry *entry, const char *str) {
+	int x = entry->startX;
+	int line = 0;
 	
-	// loop until we hit a null terminator
-	for ( ; *curr != '\0'; curr++) {
+	// last space encountered on the current line, for word wrap
+	int lastSpace = -1;
+	int lastSpaceX = 0;
+	int lastSpaceGlyph = 0;
+	
+	LayoutGlyph *glyphs = &layoutGlyphPool[entry->glyphStart];
+	int16_t *lineEnds = &layoutLineEndPool[entry->lineStart];
+	uint16_t *lineGlyphs = &layoutLineGlyphPool[entry->lineStart];
+	int glyphCount = 0;
+	lineGlyphs[0] = 0;
+	
+	for (int i = 0; i < entry->length; i++) {
+		char curr = str[i];
 		// lower than space, larger than tilde, and not newline
-		if((*curr < 0x20 && *curr != '\n') || *curr > 0x7e) {
+		if ((curr < 0x20 && curr != '\n') || curr > 0x7e) {
 			continue;
 		}
 		
-		// move to new line if needed
-		if (draw && curr == lastSpaceList[workingSpaceIndex] && workingSpaceIndex != lastSpaceListIndex && allowWordWrap) {
-			advanceCursorLine();
-			workingSpaceIndex++;
-			continue;
-		}
-		
-		// get texture coordinates
-		// font sheet starts at 0x20 ascii, 10 chars per line
-		int charIndex = (*curr) - 0x20;
-		texturePosX1 = (charIndex % 10) * PRINT_FONT_CHAR_WIDTH;
-		texturePosY1 = (charIndex / 10) * 16;
-		
 		// go to a "new line" if drawing would put us outside the safe area, or if newline
-		if (cursorX + 10 > screenWidth - (workingHorizontalPadding * 2) || *curr == '\n') {
-			// move cursor back to the last 'space' char we encountered
-			if (*curr != ' ' && *curr != '\n' && !draw && allowWordWrap) {
-				// cursorX gets set to zero later, but this is for bg drawing if applicable
-				cursorX -= (10 * (curr - lastSpaceList[lastSpaceListIndex]));
-				// move current char back to last non-space char
-				curr = lastSpaceList[lastSpaceListIndex];
-				// we only increment here because _this_ space is the important one
-				lastSpaceListIndex++;
+		if (x + 10 > entry->lineWidth || curr == '\n') {
+			// move back to the last 'space' char we encountered, the current word goes on the next line
+			if (curr != ' ' && curr != '\n' && entry->wordWrap && lastSpace != -1) {
+				x = lastSpaceX;
+				glyphCount = lastSpaceGlyph;
+				i = lastSpace;
+				curr = ' ';
 			}
-			
-			// draw our background color, if applicable
-			if (!draw && !allowWordWrap) {
-				drawSolidBox(workingX + workingHorizontalPadding - 2, workingY + PRINT_PADDING_VERTICAL - 2,
-			       cursorX + workingHorizontalPadding, cursorY + PRINT_PADDING_VERTICAL + PRINT_FONT_CHAR_HEIGHT, bgColor);
-			}
-			advanceCursorLine();
-			workingX = cursorX;
-			workingY = cursorY;
-			// advance cursor by one if newline or space
-			if (*curr == '\n' || (*curr == ' ' && allowWordWrap)) {
+			lineEnds[line] = x;
+			line++;
+			lineGlyphs[line] = glyphCount;
+			x = 0;
+			lastSpace = -1;
+			// newlines and the space we broke on aren't drawn
+			if (curr == '\n' || (curr == ' ' && entry->wordWrap)) {
 				continue;
 			}
 		}
 		
-		// store last encountered space char
-		if (*curr == ' ' && !draw && allowWordWrap) {
-			lastSpaceList[lastSpaceListIndex] = curr;
-		}
-		
-		// determine real coordinates for drawing
-		if (draw) {
-			int quadX1 = cursorX + workingHorizontalPadding;
-			int quadY1 = cursorY + PRINT_PADDING_VERTICAL;
-			int quadX2 = quadX1 + PRINT_FONT_CHAR_WIDTH;
-			int quadY2 = quadY1 + PRINT_FONT_CHAR_HEIGHT;
-			
-			// get secondary coordinates for texture
-			int texturePosX2 = texturePosX1 + PRINT_FONT_CHAR_WIDTH;
-			int texturePosY2 = texturePosY1 + PRINT_FONT_CHAR_HEIGHT;
-			
-			// draw the char
-			drawSubTexture(quadX1, quadY1, quadX2, quadY2,
-						   texturePosX1, texturePosY1, texturePosX2, texturePosY2,
-						   fgColor);
+		// spaces are blank in the fontsheet, so we only need to advance
+		if (curr == ' ') {
+			lastSpace = i;
+			lastSpaceX = x;
+			lastSpaceGlyph = glyphCount;
+		} else {
+			glyphs[glyphCount].x = x;
+			glyphs[glyphCount].line = line;
+			// font sheet starts at 0x20 ascii
+			glyphs[glyphCount].charIndex = curr - 0x20;
+			glyphCount++;
 		}
 		
 		// advance cursor
-		cursorX += 10;
+		x += 10;
+	}
+	lineEnds[line] = x;
+	
+	entry->glyphCount = glyphCount;
+	entry->lineCount = line + 1;
+	entry->endX = x;
+}
+
+// find the layout for strBuffer in the cache, laying it out if it isn't there
+static LayoutEntry* getStringLayout() {
+	int length = strlen(strBuffer);
+	int lineWidth = screenWidth - (workingHorizontalPadding * 2);
+	
+	if (length < LAYOUT_CACHE_MIN_LENGTH) {
+		LayoutEntry *entry = &layoutScratchEntry;
+		entry->length = length;
+		entry->startX = cursorX;
+		entry->lineWidth = lineWidth;
+		entry->wordWrap = allowWordWrap;
+		entry->glyphStart = 0;
+		entry->lineStart = 0;
+		layoutString(entry, strBuffer);
+		return entry;
 	}
-	if (workingX != cursorX && !draw) {
-		drawSolidBox(workingX + workingHorizontalPadding - 2, workingY + PRINT_PADDING_VERTICAL - 2,
-		       cursorX + workingHorizontalPadding, cursorY + PRINT_PADDING_VERTICAL + PRINT_FONT_CHAR_HEIGHT, bgColor);
+	
+	uint32_t hash = hashString(strBuffer, length);
+	LayoutEntry *set = layoutEntries[hash % LAYOUT_CACHE_SETS];
+	layoutUseCount++;
+	
+	// an unused entry in the set, or the least recently used one if they're all taken
+	LayoutEntry *entry = &set[0];
+	for (int i = 0; i < LAYOUT_CACHE_WAYS; i++) {
+		if (set[i].used && set[i].hash == hash && set[i].length == length && set[i].startX == cursorX &&
+		    set[i].lineWidth == lineWidth && set[i].wordWrap == allowWordWrap &&
+		    memcmp(&layoutCharPool[set[i].charStart], strBuffer, length) == 0) {
+			set[i].lastUse = layoutUseCount;
+			return &set[i];
+		}
+		if (entry->used && (!set[i].used || set[i].lastUse < entry->lastUse)) {
+			entry = &set[i];
+		}
 	}
-	if (!draw) {
-		cursorX = startingX;
-		cursorY = startingY;
+	
+	if (!entry->used || entry->capacity < length) {
+		if (layoutCharPoolUsed + length > LAYOUT_POOL_SIZE ||
+		    layoutGlyphPoolUsed + length > LAYOUT_POOL_SIZE ||
+		    layoutLinePoolUsed + length + 1 > LAYOUT_POOL_SIZE) {
+			clearLayoutCache();
+		}
+		entry->capacity = length;
+		entry->charStart = layoutCharPoolUsed;
+		entry->glyphStart = layoutGlyphPoolUsed;
+		entry->lineStart = layoutLinePoolUsed;
+		layoutCharPoolUsed += length;
+		layoutGlyphPoolUsed += length;
+		layoutLinePoolUsed += length + 1;
 	}
+	
+	entry->used = true;
+	entry->lastUse = layoutUseCount;
+	entry->hash = hash;
+	entry->length = length;
+	entry->startX = cursorX;
+	entry->lineWidth = lineWidth;
+	entry->wordWrap = allowWordWrap;
+	memcpy(&layoutCharPool[entry->charStart], strBuffer, length);
+	
+	layoutString(entry, strBuffer);
+	
+	return entry;
 }
 
-// TODO: there's a better way to do this instead of calling handleString twice...
-static void handleStringPre(const GXColor bg_color, const GXColor fg_color) {
-	// reset word wrap index if needed
-	if (allowWordWrap) {
-		lastSpaceListIndex = 0;
+// vertical range that can actually be seen while in a scrolling print, in cursor coordinates
+// see startScrollingPrint()
+static bool scrollClipActive = false;
+static int scrollClipHeight = 0;
+
+// range of lines in a string starting at the cursor that are inside the scrolling print window
+// everything is visible outside of a scrolling print
+// last is less than first if nothing is visible
+static void getVisibleLines(int lineCount, int lineHeight, int *first, int *last) {
+	*first = 0;
+	*last = lineCount - 1;
+	if (!scrollClipActive) {
+		return;
 	}
 	
-	// setup
-	changeLoadedTexmap(TEXMAP_FONT);
+	// top of the first line, backgrounds start 2 above this
+	int top = cursorY + PRINT_PADDING_VERTICAL;
+	if (top + PRINT_FONT_CHAR_HEIGHT <= 0) {
+		*first = ((0 - top - PRINT_FONT_CHAR_HEIGHT) / lineHeight) + 1;
+	}
+	if (top - 2 >= scrollClipHeight) {
+		*last = -1;
+	} else if ((scrollClipHeight - top + 1) / lineHeight < *last) {
+		*last = (scrollClipHeight - top + 1) / lineHeight;
+	}
+}
+
+// draws whatever is in strBuffer at the cursor, then moves the cursor to the end of the string
+// TODO: this might not respect a call to setDepthForDrawCall(), investigate...
+static void handleString(const GXColor bg_color, const GXColor fg_color) {
+	const LayoutEntry *entry = getStringLayout();
+	const int lineHeight = PRINT_FONT_CHAR_HEIGHT + LINE_SPACING + printOffset;
+	
+	// in a scrolling print, only lines that intersect the window are drawn
+	int firstLine, lastLine;
+	getVisibleLines(entry->lineCount, lineHeight, &firstLine, &lastLine);
 	
-	// do a first loop to draw background color if needed
-	if (bg_color.a != 0x00 || allowWordWrap) {
+	// background color goes behind the text
+	// this gets dropped first if we're running out of frame time, see getRenderDetail()
+	if (bg_color.a != 0x00 && getRenderDetail() != DETAIL_MINIMAL) {
 		setDepth(cursorZ - 1);
-		handleString(false, bg_color, fg_color);
+		const int16_t *lineEnds = &layoutLineEndPool[entry->lineStart];
+		for (int i = firstLine; i <= lastLine; i++) {
+			int lineStartX = (i == 0) ? entry->startX : 0;
+			if (lineStartX == lineEnds[i]) {
+				continue;
+			}
+			int lineY = cursorY + (i * lineHeight);
+			drawSolidBox(lineStartX + workingHorizontalPadding - 2, lineY + PRINT_PADDING_VERTICAL - 2,
+			             lineEnds[i] + workingHorizontalPadding, lineY + PRINT_PADDING_VERTICAL + PRINT_FONT_CHAR_HEIGHT,
+			             bg_color);
+		}
 		restorePrevDepth();
 	}
+	
+	changeLoadedTexmap(TEXMAP_FONT);
 	setDepth(cursorZ);
-	handleString(true, bg_color, fg_color);
+	const LayoutGlyph *glyphs = &layoutGlyphPool[entry->glyphStart];
+	const uint16_t *lineGlyphs = &layoutLineGlyphPool[entry->lineStart];
+	int glyphStart = entry->glyphCount, glyphEnd = entry->glyphCount;
+	if (firstLine <= lastLine) {
+		glyphStart = lineGlyphs[firstLine];
+		if (lastLine + 1 < entry->lineCount) {
+			glyphEnd = lineGlyphs[lastLine + 1];
+		}
+	}
+	for (int i = glyphStart; i < glyphEnd; i++) {
+		// 10 chars per line in the font sheet
+		int texturePosX1 = (glyphs[i].charIndex % 10) * PRINT_FONT_CHAR_WIDTH;
+		int texturePosY1 = (glyphs[i].charIndex / 10) * 16;
+		
+		int quadX1 = glyphs[i].x + workingHorizontalPadding;
+		int quadY1 = cursorY + (glyphs[i].line * lineHeight) + PRINT_PADDING_VERTICAL;
+		
+		drawSubTexture(quadX1, quadY1, quadX1 + PRINT_FONT_CHAR_WIDTH, quadY1 + PRINT_FONT_CHAR_HEIGHT,
+		               texturePosX1, texturePosY1,
+		               texturePosX1 + PRINT_FONT_CHAR_WIDTH, texturePosY1 + PRINT_FONT_CHAR_HEIGHT,
+		               fg_color);
+	}
 	restorePrevDepth();
+	
+	cursorX = entry->endX;
+	cursorY += (entry->lineCount - 1) * lineHeight;
 }
 
 void printStr(const char* str, ...) {
@@ -173,7 +353,7 @@ void printStr(const char* str, ...) {
 	vsnprintf(strBuffer, 999, str, list);
 	va_end(list);
 	
-	handleStringPre(GX_COLOR_NONE, GX_COLOR_WHITE);
+	handleString(GX_COLOR_NONE, GX_COLOR_WHITE);
 }
 
 void printStrColor(const GXColor bg_color, const GXColor fg_color, const char* str, ...) {
@@ -182,7 +362,7 @@ void printStrColor(const GXColor bg_color, const GXColor fg_color, const char* s
 	vsnprintf(strBuffer, 999, str, list);
 	va_end(list);
 	
-	handleStringPre(bg_color, fg_color);
+	handleString(bg_color, fg_color);
 }
 
 /*
@@ -229,16 +409,16 @@ void printStrBox(const GXColor box_color, const char* str, ...) {
 	
 	// we don't do anything if we would draw off the screen
 	if (cursorX + 2 + (length * 10) <= screenWidth - (workingHorizontalPadding * 2)) {
-		GX_SetLineWidth(8, GX_TO_ZERO);
+		setLineWidth(8);
 		
 		setDepthForDrawCall(cursorZ);
 		drawBox(cursorX + workingHorizontalPadding - 5, cursorY + PRINT_PADDING_VERTICAL - 4,
 		             cursorX + workingHorizontalPadding + (length * 10) + 2, cursorY + PRINT_PADDING_VERTICAL + 16,
 					 box_color);
 		
-		GX_SetLineWidth(12, GX_TO_ZERO);
+		setLineWidth(12);
 		
-		handleStringPre(GX_COLOR_BLACK, GX_COLOR_WHITE);
+		handleString(GX_COLOR_BLACK, GX_COLOR_WHITE);
 	}
 }
 
@@ -266,6 +446,14 @@ void drawFontButton(enum FONT_BUTTON_LIST button) {
 		advanceCursorLine();
 	}
 	
+	// off screen in a scrolling print, the cursor still needs to move
+	if (scrollClipActive && (cursorY + PRINT_PADDING_VERTICAL + 18 <= 0 ||
+	                         cursorY + PRINT_PADDING_VERTICAL - 2 >= scrollClipHeight)) {
+		dpadDirections = FONT_DPAD_NONE;
+		cursorX += 24;
+		return;
+	}
+	
 	int texX1 = 20 * (button % 6);
 	int texY1 = 20 * (button / 6);
 	
@@ -337,6 +525,7 @@ void resetScrollingPrint() {
 	scrollBottom = 480;
 	scrollXMid = 320;
 	screenWidth = 640;
+	scrollClipActive = false;
 }
 
 void startScrollingPrint(int x1, int y1, int x2, int y2) {
@@ -383,6 +572,8 @@ void startScrollingPrint(int x1, int y1, int x2, int y2) {
 	workingHorizontalPadding = 10;
 	setSubwindowScissorBox(x1, y1, x2, y2);
 	setCursorDepth(2);
+	scrollClipActive = true;
+	scrollClipHeight = y2 - y1;
 }
 
 void endScrollingPrint() {
@@ -408,6 +599,7 @@ void endScrollingPrint() {
 	
 	// set everything back to normal
 	restoreNormalScissorBox();
+	scrollClipActive = false;
 	setCursorXY(tempX, tempY);
 	screenWidth = 640;
 	workingHorizontalPadding = PRINT_PADDING_HORIZONTAL;
@@ -434,7 +626,6 @@ void printEllipse(const int counter, const int interval) {
 		printStr(".");
 		remainder--;
 	}
-	lastSpaceListIndex = 0;
 }
 
 static char lineSpinArr[] = { '/', '-', '\\', '|' };
@@ -457,7 +648,6 @@ void printSpinningLineInterval(const int waitInterval) {
 		lineSpinArrIndex %= 4;
 		intervalCounter = currInterval;
 	}
-	lastSpaceListIndex = 0;
 }
 
 void resetCursor() {
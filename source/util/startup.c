@@ -0,0 +1,89 @@
+//
+// Created on 10/19/26.
+//
+
+#include "util/startup.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <ogc/timesupp.h>
+
+#include "util/print.h"
+#include "util/file.h"
+#include "util/datetime.h"
+
+static const char *phaseNames[STARTUP_PHASE_LEN] = { "video", "textures", "gx", "args", "recordings",
+		"first_poll", "first_frame", "filesystem" };
+
+static uint64_t startTick = 0;
+// 0 until the phase is marked
+static volatile uint64_t phaseTicks[STARTUP_PHASE_LEN] = { 0 };
+
+void startStartupTimeline() {
+	startTick = gettime();
+}
+
+void markStartupPhase(enum STARTUP_PHASE phase) {
+	if (phase < STARTUP_PHASE_LEN && phaseTicks[phase] == 0) {
+		phaseTicks[phase] = gettime();
+	}
+}
+
+uint32_t getStartupPhaseUs(enum STARTUP_PHASE phase) {
+	if (phase >= STARTUP_PHASE_LEN || phaseTicks[phase] == 0) {
+		return 0;
+	}
+	return ticks_to_microsecs(phaseTicks[phase] - startTick);
+}
+
+bool isStartupTimelineDone() {
+	for (int i = 0; i < STARTUP_PHASE_LEN; i++) {
+		if (phaseTicks[i] == 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void drawStartupTimeline(int row, int col) {
+	for (int i = 0; i < STARTUP_PHASE_LEN; i++) {
+		setCursorPos(row + i, col);
+		if (phaseTicks[i] == 0) {
+			printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "%11s: ----- ms", phaseNames[i]);
+		} else {
+			uint32_t us = getStartupPhaseUs(i);
+			printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "%11s: %5u.%u ms", phaseNames[i], us / 1000,
+			              (us % 1000) / 100);
+		}
+	}
+}
+
+int logStartupTimeline() {
+	if (!initFilesystem()) {
+		return 2;
+	}
+	
+	char *timeStr = getDateTimeStr();
+	
+	if (!createGTSDirectory()) {
+		free(timeStr);
+		return 3;
+	}
+	
+	char fileStr[64];
+	snprintf(fileStr, 64, "/GTS/startup_%s.csv", timeStr);
+	free(timeStr);
+	
+	FILE *fp = openFile(fileStr, "w");
+	if (fp == NULL) {
+		return 4;
+	}
+	
+	fprintf(fp, "phase,us\n");
+	for (int i = 0; i < STARTUP_PHASE_LEN; i++) {
+		fprintf(fp, "%s,%u\n", phaseNames[i], (unsigned int) getStartupPhaseUs(i));
+	}
+	fclose(fp);
+	return 0;
+}
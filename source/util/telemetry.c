@@ -0,0 +1,181 @@
+//
+// Created on 10/19/26.
+//
+
+#include "util/telemetry.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "util/gx.h"
+#include "util/print.h"
+#include "util/file.h"
+#include "util/polling.h"
+#include "util/datetime.h"
+
+// everything we keep track of, per frame
+enum TELEMETRY_FIELD { TM_LOGIC_US, TM_GX_US, TM_VERTICES, TM_BATCHES, TM_STATE_ISSUED,
+		TM_STATE_ELIDED, TM_DISPLAY_LISTS, TM_FIFO_BYTES, TM_RENDER_DETAIL,
+		TM_INPUT_LATENCY_US, TM_GRAPH_US, TM_FIELD_LEN };
+
+static const char *fieldNames[TM_FIELD_LEN] = { "logic_us", "gx_us", "vertices", "batches", "state_issued",
+		"state_elided", "display_lists", "fifo_bytes", "render_detail",
+		"input_latency_us", "graph_us" };
+
+static const char *menuNames[ERR + 1] = { "main", "controller_test", "oscilloscope", "plot_2d",
+		"plot_button", "image_test", "file_export", "coordinate_viewer", "continuous_oscilloscope",
+		"trigger_oscilloscope", "gate", "thanks", "err" };
+
+typedef struct MenuTelemetry {
+	uint32_t frames;
+	// frames where gx finished after FRAME_TIME_US
+	uint32_t framesOverBudget;
+	// times the render detail was lowered while in this menu, see getRenderDetail()
+	uint32_t detailDegrades;
+	uint64_t total[TM_FIELD_LEN];
+	uint32_t max[TM_FIELD_LEN];
+} MenuTelemetry;
+
+static MenuTelemetry menuTelemetry[ERR + 1];
+static enum CURRENT_MENU lastMenu = ERR;
+static uint32_t lastDegradeCount = 0;
+
+// last frame, for the overlay
+static uint32_t lastFrame[TM_FIELD_LEN] = { 0 };
+
+static FILE *logFile = NULL;
+static bool logFileFailed = false;
+
+// same naming as exportData(), so logs from different runs don't collide
+static bool openLogFile() {
+	if (logFile != NULL) {
+		return true;
+	}
+	if (logFileFailed || !initFilesystem()) {
+		logFileFailed = true;
+		return false;
+	}
+	
+	if (!createGTSDirectory()) {
+		logFileFailed = true;
+		return false;
+	}
+	
+	char *timeStr = getDateTimeStr();
+	char fileStr[64];
+	snprintf(fileStr, 64, "/GTS/telemetry_%s.csv", timeStr);
+	free(timeStr);
+	
+	logFile = openFile(fileStr, "w");
+	if (logFile == NULL) {
+		logFileFailed = true;
+		return false;
+	}
+	
+	// header, average and max for each field
+	fprintf(logFile, "menu,frames,frames_over_budget,detail_degrades");
+	for (int i = 0; i < TM_FIELD_LEN; i++) {
+		fprintf(logFile, ",%s_avg,%s_max", fieldNames[i], fieldNames[i]);
+	}
+	fprintf(logFile, "\n");
+	return true;
+}
+
+// write a menu's totals, and clear them
+static void logMenu(enum CURRENT_MENU menu) {
+	MenuTelemetry *entry = &menuTelemetry[menu];
+	if (entry->frames == 0 || !openLogFile()) {
+		return;
+	}
+	
+	fprintf(logFile, "%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32, menuNames[menu], entry->frames,
+	        entry->framesOverBudget, entry->detailDegrades);
+	for (int i = 0; i < TM_FIELD_LEN; i++) {
+		fprintf(logFile, ",%" PRIu64 ",%" PRIu32, entry->total[i] / entry->frames, entry->max[i]);
+	}
+	fprintf(logFile, "\n");
+	// we don't know when the console will get turned off, so make sure this actually gets written
+	fflush(logFile);
+	
+	memset(entry, 0, sizeof(MenuTelemetry));
+}
+
+void recordFrameTelemetry(enum CURRENT_MENU menu, uint32_t logicUs, uint32_t gxUs) {
+	if (menu > ERR) {
+		return;
+	}
+	
+	if (menu != lastMenu) {
+		logMenu(lastMenu);
+		lastMenu = menu;
+	}
+	
+	GXFrameStats stats;
+	getGXFrameStats(&stats);
+	RenderDetailStats detailStats;
+	getRenderDetailStats(&detailStats);
+	
+	lastFrame[TM_LOGIC_US] = logicUs;
+	lastFrame[TM_GX_US] = gxUs;
+	lastFrame[TM_VERTICES] = stats.vertices;
+	lastFrame[TM_BATCHES] = stats.batches;
+	lastFrame[TM_STATE_ISSUED] = stats.stateIssued;
+	lastFrame[TM_STATE_ELIDED] = stats.stateElided;
+	lastFrame[TM_DISPLAY_LISTS] = stats.displayLists;
+	lastFrame[TM_FIFO_BYTES] = stats.fifoHighWater;
+	lastFrame[TM_RENDER_DETAIL] = getRenderDetail();
+	// this is the latest frame that made it to the screen, which is usually the one before this
+	lastFrame[TM_INPUT_LATENCY_US] = getInputLatencyUs();
+	lastFrame[TM_GRAPH_US] = stats.graphUs;
+	
+	MenuTelemetry *entry = &menuTelemetry[menu];
+	entry->frames++;
+	if (gxUs > FRAME_TIME_US) {
+		entry->framesOverBudget++;
+	}
+	entry->detailDegrades += detailStats.degradeCount - lastDegradeCount;
+	lastDegradeCount = detailStats.degradeCount;
+	for (int i = 0; i < TM_FIELD_LEN; i++) {
+		entry->total[i] += lastFrame[i];
+		if (lastFrame[i] > entry->max[i]) {
+			entry->max[i] = lastFrame[i];
+		}
+	}
+}
+
+void drawTelemetryOverlay() {
+	MenuTelemetry *entry = &menuTelemetry[lastMenu];
+	
+	setCursorPos(17, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "LAT: %5u", lastFrame[TM_INPUT_LATENCY_US]);
+	setCursorPos(18, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "DETAIL: %u | LOWERED: %3u",
+	              lastFrame[TM_RENDER_DETAIL], entry->detailDegrades);
+	setCursorPos(19, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "WORST: %5u | OVER: %4u",
+	              entry->max[TM_GX_US], entry->framesOverBudget);
+	setCursorPos(20, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "VTX: %5u | BEGIN: %4u",
+	              lastFrame[TM_VERTICES], lastFrame[TM_BATCHES]);
+	setCursorPos(21, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "FIFO: %6u | DL: %3u",
+	              lastFrame[TM_FIFO_BYTES], lastFrame[TM_DISPLAY_LISTS]);
+	setCursorPos(22, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "STATE: %4u | SKIP: %4u",
+	              lastFrame[TM_STATE_ISSUED], lastFrame[TM_STATE_ELIDED]);
+	setCursorPos(23, 32);
+	printStrColor(GX_COLOR_WHITE, GX_COLOR_BLACK, "LOGIC: %5u | GX: %5u",
+	              lastFrame[TM_LOGIC_US], lastFrame[TM_GX_US]);
+}
+
+void stopTelemetry() {
+	for (int i = 0; i <= ERR; i++) {
+		logMenu(i);
+	}
+	if (logFile != NULL) {
+		fclose(logFile);
+		logFile = NULL;
+	}
+}
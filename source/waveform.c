@@ -24,6 +24,9 @@ static ControllerRec *recordingData = NULL;
 static ControllerRec *tempData = NULL;
 static ControllerRec *continuousMenuData = NULL;
 
+// shared between all recordings, so that two recordings never end up with the same revision
+static uint32_t revisionCounter = 0;
+
 // allocate memory for and initialize recording structs
 void initControllerRecStructs() {
 	if (!init) {
@@ -82,6 +85,7 @@ void clearRecordingArray(ControllerRec *recording) {
 	recording->recordingType = REC_CLEAR;
 	recording->isRecordingReady = false;
 	recording->dataExported = false;
+	markRecordingUpdated(recording);
 }
 
 // change what static pointers are pointing to
@@ -95,16 +99,44 @@ void flipData() {
 	// mark "old" data as not ready for display
 	tempData->isRecordingReady = false;
 	tempData->dataExported = false;
+	
+	// newly displayed data
+	markRecordingUpdated(recordingData);
+}
+
+void markRecordingUpdated(ControllerRec *recording) {
+	revisionCounter++;
+	recording->revision = revisionCounter;
+}
+
+uint32_t getLatestRecordingRevision() {
+	return revisionCounter;
 }
 
 // a lot of this comes from github.com/phobgcc/phobconfigtool
-MeleeCoordinates convertStickRawToMelee(ControllerSample sample) {
-	
-	float floatStickX = abs(sample.stickX), floatStickY = abs(sample.stickY);
-	float floatCStickX = abs(sample.cStickX), floatCStickY = abs(sample.cStickY);
+// convertStickRawToMelee() used to do the float math below for every call,
+// but each stick's result only depends on that stick's two values, so every pair is worked out once on first use.
+// the result doesn't depend on the sign either, so by default only one quadrant is stored (~33 KB),
+// MELEE_COORD_LUT_FULL stores all 256x256 pairs instead (128 KB), which skips the abs() when looking one up
+typedef struct MeleeUnitPair {
+	uint8_t x;
+	uint8_t y;
+} MeleeUnitPair;
+
+#ifdef MELEE_COORD_LUT_FULL
+static MeleeUnitPair meleeUnitTable[256][256];
+#else
+static MeleeUnitPair meleeUnitTable[129][129];
+#endif
+// whole units (0 -> 80) to the decimal format for melee
+static uint16_t meleeUnitValues[81];
+static bool meleeUnitTableReady = false;
+
+// the original conversion for a single stick, everything in the tables comes from this
+static MeleeUnitPair convertAxisPairToMeleeUnits(int stickX, int stickY) {
+	float floatStickX = abs(stickX), floatStickY = abs(stickY);
 	
-	float stickMagnitude = sqrt((sample.stickX * sample.stickX) + (sample.stickY * sample.stickY));
-	float cStickMagnitude = sqrt((sample.cStickX * sample.cStickX) + (sample.cStickY * sample.cStickY));
+	float stickMagnitude = sqrt((stickX * stickX) + (stickY * stickY));
 	
 	// magnitude must be between 0 and 80
 	if (stickMagnitude > 80) {
@@ -112,23 +144,54 @@ MeleeCoordinates convertStickRawToMelee(ControllerSample sample) {
 		floatStickX = (floatStickX / stickMagnitude) * 80;
 		floatStickY = (floatStickY / stickMagnitude) * 80;
 	}
-	if (cStickMagnitude > 80) {
-		// scale stick value to be within range
-		floatCStickX = (floatCStickX / cStickMagnitude) * 80;
-		floatCStickY = (floatCStickY / cStickMagnitude) * 80;
-	}
-	
-	MeleeCoordinates ret;
 	
 	// truncate the floats
-	ret.stickXUnit = (int) floatStickX, ret.stickYUnit = (int) floatStickY;
-	ret.cStickXUnit = (int) floatCStickX, ret.cStickYUnit = (int) floatCStickY;
+	return (MeleeUnitPair) { (int) floatStickX, (int) floatStickY };
+}
+
+static void initMeleeUnitTable() {
+	#ifdef MELEE_COORD_LUT_FULL
+	for (int x = -128; x <= 127; x++) {
+		for (int y = -128; y <= 127; y++) {
+			meleeUnitTable[(uint8_t) x][(uint8_t) y] = convertAxisPairToMeleeUnits(x, y);
+		}
+	}
+	#else
+	for (int x = 0; x <= 128; x++) {
+		for (int y = 0; y <= 128; y++) {
+			meleeUnitTable[x][y] = convertAxisPairToMeleeUnits(x, y);
+		}
+	}
+	#endif
 	
 	// convert to the decimal format for melee
-	ret.stickXUnit = (((float) ret.stickXUnit) * 0.0125) * 10000;
-	ret.stickYUnit = (((float) ret.stickYUnit) * 0.0125) * 10000;
-	ret.cStickXUnit = (((float) ret.cStickXUnit) * 0.0125) * 10000;
-	ret.cStickYUnit = (((float) ret.cStickYUnit) * 0.0125) * 10000;
+	for (int i = 0; i <= 80; i++) {
+		meleeUnitValues[i] = (((float) i) * 0.0125) * 10000;
+	}
+	
+	meleeUnitTableReady = true;
+}
+
+static inline MeleeUnitPair getMeleeUnitPair(int8_t stickX, int8_t stickY) {
+	#ifdef MELEE_COORD_LUT_FULL
+	return meleeUnitTable[(uint8_t) stickX][(uint8_t) stickY];
+	#else
+	return meleeUnitTable[abs(stickX)][abs(stickY)];
+	#endif
+}
+
+MeleeCoordinates convertStickRawToMelee(ControllerSample sample) {
+	if (!meleeUnitTableReady) {
+		initMeleeUnitTable();
+	}
+	
+	MeleeUnitPair stick = getMeleeUnitPair(sample.stickX, sample.stickY);
+	MeleeUnitPair cStick = getMeleeUnitPair(sample.cStickX, sample.cStickY);
+	
+	MeleeCoordinates ret;
+	
+	ret.stickXUnit = meleeUnitValues[stick.x], ret.stickYUnit = meleeUnitValues[stick.y];
+	ret.cStickXUnit = meleeUnitValues[cStick.x], ret.cStickYUnit = meleeUnitValues[cStick.y];
 	
 	// record if a given axis was negative, since we don't retain that info in the converted units
 	ret.stickXNegative = (sample.stickX < 0) ? true : false;